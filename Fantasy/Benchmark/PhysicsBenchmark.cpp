@@ -0,0 +1,326 @@
+#include <SceneManager.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <atomic>
+#include <chrono>
+#include <new>
+
+//NOTE(kai): headless physics benchmark, builds a synthetic scene and runs PhysicsEngine::Update on it.
+//			 the checksum is over the final positions, the same settings have to give the same checksum
+//
+//			 Benchmark.exe -n 2000 -static 0.5 -density 0.15 -speed 300 -fast 0.02 -ticks 600 -seed 1 -threads 0
+
+file_internal std::atomic<uint64> Allocations(0);
+file_internal std::atomic<uint64> AllocatedBytes(0);
+
+void* operator new(size_t size)
+{
+	Allocations++;
+	AllocatedBytes += size;
+
+	void *memory = malloc(size ? size : 1);
+
+	if (!memory)
+	{
+		throw std::bad_alloc();
+	}
+
+	return memory;
+}
+
+void* operator new[](size_t size)
+{
+	return operator new(size);
+}
+
+void operator delete(void *memory)
+{
+	free(memory);
+}
+
+void operator delete[](void *memory)
+{
+	free(memory);
+}
+
+struct BenchmarkSettings
+{
+	uint32 ColliderCount;
+	float StaticRatio;
+	float Density;
+	float Speed;
+	float FastRatio;
+	float ContinuousRatio;
+	float MinSize;
+	float MaxSize;
+	uint32 Ticks;
+	uint32 Warmup;
+	uint32 Seed;
+	uint32 Threads;
+	uint32 Substeps;
+	bool Gravity;
+};
+
+//NOTE(kai): our own generator so the scene is the same on every CRT
+struct BenchmarkRandom
+{
+	uint32 State;
+
+	uint32 Next()
+	{
+		State ^= State << 13;
+		State ^= State >> 17;
+		State ^= State << 5;
+
+		return State;
+	}
+
+	float Range(float low, float high)
+	{
+		return low + (high - low) * ((Next() & 0xFFFFFF) / (float)0xFFFFFF);
+	}
+};
+
+file_internal void PrintUsage()
+{
+	printf("Benchmark [options]\n"
+		   "  -n <count>          colliders (2000)\n"
+		   "  -static <ratio>     share of static colliders (0.5)\n"
+		   "  -density <ratio>    collider area over world area (0.15)\n"
+		   "  -speed <units/s>    top speed of the dynamic colliders (300)\n"
+		   "  -fast <ratio>       share of dynamic colliders moving 10x faster (0.02)\n"
+		   "  -ccd <ratio>        share of dynamic colliders using continuous collision (0.02)\n"
+		   "  -size <min> <max>   collider sizes (20 120)\n"
+		   "  -ticks <count>      measured ticks (600)\n"
+		   "  -warmup <count>     ticks run before measuring (60)\n"
+		   "  -seed <value>       scene seed (1)\n"
+		   "  -threads <count>    job system workers, 0 for one a core (0)\n"
+		   "  -substeps <count>   physics substeps (1)\n"
+		   "  -gravity            dynamic colliders fall\n");
+}
+
+file_internal bool ParseSettings(int argc, char **argv, BenchmarkSettings *settings)
+{
+	*settings = { 2000, 0.5f, 0.15f, 300.0f, 0.02f, 0.02f, 20.0f, 120.0f, 600, 60, 1, 0, 1, false };
+
+	for (int i = 1; i < argc; i++)
+	{
+		char *arg = argv[i];
+		bool hasValue = i + 1 < argc;
+
+		if (!strcmp(arg, "-n") && hasValue) settings->ColliderCount = (uint32)atoi(argv[++i]);
+		else if (!strcmp(arg, "-static") && hasValue) settings->StaticRatio = (float)atof(argv[++i]);
+		else if (!strcmp(arg, "-density") && hasValue) settings->Density = (float)atof(argv[++i]);
+		else if (!strcmp(arg, "-speed") && hasValue) settings->Speed = (float)atof(argv[++i]);
+		else if (!strcmp(arg, "-fast") && hasValue) settings->FastRatio = (float)atof(argv[++i]);
+		else if (!strcmp(arg, "-ccd") && hasValue) settings->ContinuousRatio = (float)atof(argv[++i]);
+		else if (!strcmp(arg, "-size") && i + 2 < argc)
+		{
+			settings->MinSize = (float)atof(argv[++i]);
+			settings->MaxSize = (float)atof(argv[++i]);
+		}
+		else if (!strcmp(arg, "-ticks") && hasValue) settings->Ticks = (uint32)atoi(argv[++i]);
+		else if (!strcmp(arg, "-warmup") && hasValue) settings->Warmup = (uint32)atoi(argv[++i]);
+		else if (!strcmp(arg, "-seed") && hasValue) settings->Seed = (uint32)atoi(argv[++i]);
+		else if (!strcmp(arg, "-threads") && hasValue) settings->Threads = (uint32)atoi(argv[++i]);
+		else if (!strcmp(arg, "-substeps") && hasValue) settings->Substeps = (uint32)atoi(argv[++i]);
+		else if (!strcmp(arg, "-gravity")) settings->Gravity = true;
+		else
+		{
+			PrintUsage();
+
+			return false;
+		}
+	}
+
+	if (!settings->ColliderCount || settings->Density <= 0.0f || !settings->Substeps || settings->MaxSize < settings->MinSize)
+	{
+		PrintUsage();
+
+		return false;
+	}
+
+	if (!settings->Seed)
+	{
+		settings->Seed = 1;
+	}
+
+	return true;
+}
+
+file_internal float BuildScene(SceneManager *scene, BenchmarkSettings *settings, std::vector<Collider *> *dynamics)
+{
+	BenchmarkRandom random = { settings->Seed };
+
+	float averageSize = (settings->MinSize + settings->MaxSize) / 2.0f;
+	float worldSize = sqrtf(settings->ColliderCount * averageSize * averageSize / settings->Density);
+
+	uint32 staticCount = (uint32)(settings->ColliderCount * settings->StaticRatio);
+
+	for (uint32 i = 0; i < settings->ColliderCount; i++)
+	{
+		//NOTE(kai): objects are looked up by name pointer, every one needs its own
+		char *name = new char[24];
+		sprintf(name, "body %u", i);
+
+		GameObject *object = scene->AddObject(name);
+		object->ObjectTransform.Position = vec3f(random.Range(0.0f, worldSize), random.Range(0.0f, worldSize), 0.0f);
+
+		vec2f size = vec2f(random.Range(settings->MinSize, settings->MaxSize), random.Range(settings->MinSize, settings->MaxSize));
+		bool isStatic = i < staticCount;
+
+		object->AddComponent(&Collider("body", &object->ObjectTransform.Position, size, vec2f(), isStatic, false));
+
+		Collider *collider = (Collider *)object->GetComponent("body", "COLLIDER");
+
+		if (isStatic)
+		{
+			continue;
+		}
+
+		float speed = settings->Speed;
+
+		if (random.Range(0.0f, 1.0f) < settings->FastRatio)
+		{
+			speed *= 10.0f;
+		}
+
+		collider->dynamic = true;
+		collider->useGravity = settings->Gravity;
+		collider->continuous = random.Range(0.0f, 1.0f) < settings->ContinuousRatio;
+		collider->linearVelocity = vec2f(random.Range(-speed, speed), random.Range(-speed, speed));
+
+		dynamics->push_back(collider);
+	}
+
+	return worldSize;
+}
+
+//NOTE(kai): bounce off the edges so the density stays what was asked for
+file_internal void KeepInWorld(std::vector<Collider *> *dynamics, float worldSize)
+{
+	for (uint32 i = 0; i < dynamics->size(); i++)
+	{
+		Collider *collider = (*dynamics)[i];
+
+		if ((collider->pos->X < 0.0f && collider->linearVelocity.X < 0.0f)
+			|| (collider->pos->X > worldSize && collider->linearVelocity.X > 0.0f))
+		{
+			collider->linearVelocity.X = -collider->linearVelocity.X;
+		}
+
+		if ((collider->pos->Y < 0.0f && collider->linearVelocity.Y < 0.0f)
+			|| (collider->pos->Y > worldSize && collider->linearVelocity.Y > 0.0f))
+		{
+			collider->linearVelocity.Y = -collider->linearVelocity.Y;
+		}
+	}
+}
+
+file_internal uint32 Checksum(std::vector<Collider *> *dynamics)
+{
+	//NOTE(kai): FNV-1a over the bits of the positions
+	uint32 hash = 2166136261u;
+
+	for (uint32 i = 0; i < dynamics->size(); i++)
+	{
+		float values[2] = { (*dynamics)[i]->pos->X, (*dynamics)[i]->pos->Y };
+		uint8 *bytes = (uint8 *)values;
+
+		for (uint32 j = 0; j < sizeof(values); j++)
+		{
+			hash = (hash ^ bytes[j]) * 16777619u;
+		}
+	}
+
+	return hash;
+}
+
+int main(int argc, char **argv)
+{
+	BenchmarkSettings settings;
+
+	if (!ParseSettings(argc, argv, &settings))
+	{
+		return 1;
+	}
+
+	SceneManager *scene = new SceneManager();
+	scene->Init(settings.ColliderCount + 1);
+
+	if (settings.Threads)
+	{
+		scene->Jobs.Destroy();
+		scene->Jobs.Init(settings.Threads);
+	}
+
+	scene->PEngine.Substeps = settings.Substeps;
+
+	std::vector<Collider *> dynamics;
+	float worldSize = BuildScene(scene, &settings, &dynamics);
+	float delta = scene->PEngine.FixedDelta;
+
+	printf("%u colliders (%u dynamic) in a %.0f x %.0f world, %u job threads, %u substeps\n",
+		   settings.ColliderCount, (uint32)dynamics.size(), worldSize, worldSize,
+		   scene->Jobs.GetThreadCount(), settings.Substeps);
+
+	for (uint32 i = 0; i < settings.Warmup; i++)
+	{
+		KeepInWorld(&dynamics, worldSize);
+		scene->PEngine.Update(delta);
+	}
+
+	uint64 pairs = 0;
+	uint64 contactsFound = 0;
+	uint64 contactsResolved = 0;
+	uint64 sweeps = 0;
+	uint64 sleeping = 0;
+	double slowest = 0.0;
+
+	uint64 allocations = Allocations;
+	uint64 allocatedBytes = AllocatedBytes;
+
+	std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+
+	for (uint32 i = 0; i < settings.Ticks; i++)
+	{
+		KeepInWorld(&dynamics, worldSize);
+
+		std::chrono::high_resolution_clock::time_point tickStart = std::chrono::high_resolution_clock::now();
+
+		scene->PEngine.Update(delta);
+
+		double tick = std::chrono::duration<double, std::nano>(std::chrono::high_resolution_clock::now() - tickStart).count();
+		slowest = tick > slowest ? tick : slowest;
+
+		PhysicsStats *stats = &scene->PEngine.Stats;
+		pairs += stats->BroadphasePairs;
+		contactsFound += stats->ContactsFound;
+		contactsResolved += stats->ContactsResolved;
+		sweeps += stats->Sweeps;
+		sleeping += stats->Sleeping;
+	}
+
+	double total = std::chrono::duration<double, std::nano>(std::chrono::high_resolution_clock::now() - start).count();
+
+	allocations = Allocations - allocations;
+	allocatedBytes = AllocatedBytes - allocatedBytes;
+
+	double ticks = (double)settings.Ticks;
+
+	printf("ticks:               %u\n", settings.Ticks);
+	printf("ns/tick:             %.0f (slowest %.0f)\n", ticks ? total / ticks : 0.0, slowest);
+	printf("pairs tested/tick:   %.1f\n", ticks ? pairs / ticks : 0.0);
+	printf("contacts found/tick: %.1f\n", ticks ? contactsFound / ticks : 0.0);
+	printf("pairs hit/tick:      %.1f\n", ticks ? contactsResolved / ticks : 0.0);
+	printf("sweeps/tick:         %.1f\n", ticks ? sweeps / ticks : 0.0);
+	printf("sleeping/tick:       %.1f\n", ticks ? sleeping / ticks : 0.0);
+	printf("allocations:         %llu (%llu bytes, %.2f/tick)\n", allocations, allocatedBytes, ticks ? allocations / ticks : 0.0);
+	printf("checksum:            %08x\n", Checksum(&dynamics));
+
+	scene->Jobs.Destroy();
+
+	return 0;
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <vector>
+#include "Texture.h"
+
+#define ANIMATION_NO_CLIP 0xFFFFFFFF
+
+struct Animator;
+struct SpriteRenderer;
+
+//NOTE(kai): never changes once added, every animator that plays the clip points at the same one by ID
+struct AnimationClipAsset
+{
+	uint32 MaxCountHorizontal, MaxCountVertical;
+
+	float FrameWidth, FrameHeight;
+
+	Texture Sheet;
+
+	//NOTE(kai): frame index on the sheet and how long it stays up
+	std::vector<std::pair<uint32, float>> Frames;
+
+	char *Name;
+	bool Loop;
+};
+
+//NOTE(kai): everything an animator changes while playing, kept next to the others so one loop advances them all
+struct AnimationPlayback
+{
+	uint32 Clip;
+	uint32 LastClip;
+
+	uint32 Frame;
+	float Time;
+
+	bool Running;
+	bool StopWhenDone;
+
+	//NOTE(kai): set by Animator::Update, objects the scene didn't update this frame don't animate either
+	bool Updated;
+
+	SpriteRenderer *Renderer;
+	Animator *Owner;
+};
+
+struct AnimationSystem
+{
+	std::vector<AnimationClipAsset> Clips;
+	std::vector<AnimationPlayback> Playbacks;
+};
+
+//NOTE(kai): returns the ID of an identical clip with the same name when there is one, the new clip's ID otherwise
+uint32 AddClipAsset(AnimationSystem *system, char *name, Texture sheet, uint32 maxH, uint32 maxV
+	, std::vector<std::pair<uint32, float>> *frames, bool loop);
+
+AnimationClipAsset* GetClipAsset(AnimationSystem *system, uint32 id);
+
+uint32 AddPlayback(AnimationSystem *system, Animator *owner, SpriteRenderer *renderer);
+
+//NOTE(kai): the last playback moves into the hole and its animator gets told
+void RemovePlayback(AnimationSystem *system, uint32 index);
+
+//NOTE(kai): points the sprite's UV rect at the frame, no GL calls
+void ShowClipFrame(SpriteRenderer *renderer, AnimationClipAsset *clip, uint32 frame);
+
+void StopPlayback(AnimationPlayback *playback);
+
+void UpdateAnimations(AnimationSystem *system, float delta);
@@ -2,8 +2,9 @@
 
 #include <RenderingEngine.h>
 #include <SpriteRenderer.h>
-#include <map>
+#include <AnimationSystem.h>
 
+//NOTE(kai): describes a clip for Animator::AddClip, the animator only keeps the shared asset made from it
 struct AnimationClip
 {
 public:
@@ -20,17 +21,21 @@ public:
 
 	float FrameWidth, FrameHeight;
 	float FrameTime;
-	float Counter;
 
 	Texture Sheet;
-
-	uint32 CurrentFrame;
 	
 	std::vector<std::pair<uint32, float>> Frames;
 
-	char *Name;
 	bool Loop;
-	bool IsRunning;
+};
+
+#define ANIMATOR_MAX_CLIPS 16
+
+//NOTE(kai): the name this animator knows a shared clip by
+struct AnimatorClipSlot
+{
+	char *Name;
+	uint32 Clip;
 };
 
 struct Animator	: public GameComponent
@@ -51,6 +56,7 @@ public:
 
 	virtual void Destroy();
 
+	//NOTE(kai): only marks the playback, SceneManager::Update advances every animator at once with UpdateAnimations
 	virtual void Update(float delta, Game_Input *input);
 
 	void SetStartClip(char *name);
@@ -59,7 +65,7 @@ public:
 
 	void AddClip(char *name, AnimationClip *clip);
 
-	AnimationClip* GetClip(char *name);
+	AnimationClipAsset* GetClip(char *name);
 
 	void PauseClip();
 
@@ -75,13 +81,19 @@ public:
 	
 	bool IsRunning(char *name);
 
-private:
-	bool IsFinished();
 public:
-	AnimationClip *CurrentClip;
-	bool StopFlag;
+	//NOTE(kai): index into the scene's AnimationSystem::Playbacks
+	uint32 Playback;
+private:
+	uint32 FindClip(char *name);
+	char* FindClipName(uint32 clip);
+
+	AnimationPlayback* GetPlayback();
+
+	void ShowClip(uint32 clip);
 private:
 	SpriteRenderer *Renderer;
-	std::map<char *, AnimationClip *> *Clips;
-	AnimationClip *LastRunningClip;
+
+	AnimatorClipSlot Slots[ANIMATOR_MAX_CLIPS];
+	uint32 SlotCount;
 };
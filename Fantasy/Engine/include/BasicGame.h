@@ -25,6 +25,24 @@ public:
 		Scene->Render();
 	}
 
+	//NOTE(kai): update thread, after the updates of the frame
+	void CaptureFrame(RenderSnapshot *snapshot)
+	{
+		Scene->CaptureFrame(snapshot);
+	}
+
+	//NOTE(kai): render thread, with the GL context current
+	void RenderFrame(RenderSnapshot *snapshot)
+	{
+		Scene->RenderFrame(snapshot);
+	}
+
+	//NOTE(kai): the platform layer calls this once it draws on a thread of its own
+	void SetRenderThreaded(bool threaded)
+	{
+		Scene->REngine.Threaded = threaded;
+	}
+
 	void Update(float delta)
 	{
 		Scene->Update(delta, &Input);
@@ -38,7 +56,10 @@ public:
 		Scene->MainCamera.Size.Y = height * 2.5f;
 	}
 
-	void ShutDown(){}
+	void ShutDown()
+	{
+		Scene->Jobs.Destroy();
+	}
 
 public:
 	SceneManager *Scene;
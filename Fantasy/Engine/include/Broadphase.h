@@ -0,0 +1,60 @@
+#pragma once
+
+#include <vector>
+#include "Types.h"
+
+//NOTE(kai): proxies wider than this (the level floor) stay out of the sorted query window and are tested one by one
+#define BROADPHASE_WIDE_PROXY 2048.0f
+
+struct Collider;
+
+struct BroadphaseProxy
+{
+	float MinX, MinY;
+	float MaxX, MaxY;
+
+	uint32 LayerBits;
+	uint32 MaskBits;
+
+	//NOTE(kai): sleeping or static, two resting proxies never make a pair
+	bool Resting;
+
+	Collider *Owner;
+};
+
+struct BroadphasePair
+{
+	uint32 A;
+	uint32 B;
+};
+
+//NOTE(kai): sweep and prune on the X axis, the proxies are rebuilt every tick but
+//			 the sorted order is kept so the insertion sort only has a few swaps to do
+struct Broadphase
+{
+public:
+	void Clear();
+
+	uint32 AddProxy(BroadphaseProxy proxy);
+
+	void Sort();
+
+	void FindPairs(std::vector<BroadphasePair> *pairs);
+
+	//NOTE(kai): sorts and measures the proxies so Query can start from a binary search
+	void PrepareQueries();
+
+	//NOTE(kai): appends the proxies whose boxes touch the query box and whose layer is in layerMask
+	void Query(float minX, float minY, float maxX, float maxY, uint32 layerMask, std::vector<uint32> *result);
+public:
+	std::vector<BroadphaseProxy> Proxies;
+	std::vector<uint32> Order;
+
+	std::vector<uint32> WideProxies;
+	float MaxWidth;
+};
+
+inline bool CanCollide(BroadphaseProxy *a, BroadphaseProxy *b)
+{
+	return (a->LayerBits & b->MaskBits) && (b->LayerBits & a->MaskBits);
+}
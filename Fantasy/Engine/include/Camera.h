@@ -10,6 +10,18 @@ enum CameraType
 	PERSPECTIVE = 1
 };
 
+//NOTE(kai): axis aligned box in world space
+struct BoundingRect
+{
+	float MinX, MinY;
+	float MaxX, MaxY;
+};
+
+inline bool RectsOverlap(BoundingRect *a, BoundingRect *b)
+{
+	return a->MinX <= b->MaxX && a->MaxX >= b->MinX && a->MinY <= b->MaxY && a->MaxY >= b->MinY;
+}
+
 struct BasicCamera
 {
 public:
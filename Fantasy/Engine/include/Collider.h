@@ -23,18 +23,33 @@ public:
 		this->velocity = vec2f();
 		this->rigth = this->left = this->up = this->down = false;
 		this->jump = false;
+		this->continuous = false;
+		this->pathStart = vec2f();
+		this->hasPathStart = false;
+		this->layerBits = 1;
+		this->maskBits = 0xFFFFFFFF;
+		this->isStatic = ground;
+		this->sleeping = false;
+		this->idleTicks = 0;
+		this->restPos = vec2f();
+		this->dynamic = false;
+		this->useGravity = false;
+		this->gravityScale = 1.0f;
+		this->mass = 1.0f;
+		this->linearVelocity = vec2f();
+		this->force = vec2f();
 		this->Size = sizeof(Collider);
 	}
 
 public:
 	virtual void Update(float delta, Game_Input *input);
-	virtual void Init()
-	{
-		OldPos = &Owner->ObjectTransform.OldPos;
-	}
+	virtual void Init();
 	std::vector<char*> checkObjectCollision();
 
 	bool CheckGroundCollision();
+
+	//NOTE(kai): moves the collider without sweeping the way there
+	void Teleport(vec3f position);
 public:
 	vec3f *pos;
 	vec3f *OldPos;
@@ -52,4 +67,32 @@ public:
 	bool  rigth, left, down, up;
 	
 	bool detected;
+
+	//NOTE(kai): sweep the whole path moved this tick instead of testing where it ended up
+	bool continuous;
+
+	//NOTE(kai): where the last physics step left the collider, unset after Init or a teleport so that
+	//			 first move isn't swept
+	vec2f pathStart;
+	bool hasPathStart;
+
+	//NOTE(kai): layerBits comes from the owner's layer, maskBits can turn off more layers per collider
+	uint32 layerBits;
+	uint32 maskBits;
+
+	//NOTE(kai): static colliders never move, the ground by default. a collider that stays idle long enough
+	//			 goes to sleep and is left out of the broadphase pairs until it moves or something hits it
+	bool isStatic;
+	bool sleeping;
+	uint32 idleTicks;
+	vec2f restPos;
+
+	//NOTE(kai): dynamic colliders are moved by the physics engine from linearVelocity (units per second) and force,
+	//			 the game sets those instead of the position. velocity is then the distance moved in the last step
+	bool dynamic;
+	bool useGravity;
+	float gravityScale;
+	float mass;
+	vec2f linearVelocity;
+	vec2f force;
 };
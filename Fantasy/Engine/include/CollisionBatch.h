@@ -0,0 +1,53 @@
+#pragma once
+
+#include <vector>
+#include "Types.h"
+
+#define COLLISION_BATCH_SIZE 32
+#define COLLISION_NO_IMPACT 3.402823466e+38f
+
+//NOTE(kai): collider data laid out for the batched tests, one entry per broadphase proxy
+struct ColliderSoA
+{
+public:
+	void Clear();
+
+	uint32 Add(float centerX, float centerY, float halfX, float halfY, float velocityX, float velocityY);
+public:
+	std::vector<float> CenterX;
+	std::vector<float> CenterY;
+	std::vector<float> HalfX;
+	std::vector<float> HalfY;
+	std::vector<float> VelocityX;
+	std::vector<float> VelocityY;
+};
+
+//NOTE(kai): up to COLLISION_BATCH_SIZE candidates gathered for one collider
+struct CollisionBatch
+{
+	float CenterX[COLLISION_BATCH_SIZE];
+	float CenterY[COLLISION_BATCH_SIZE];
+	float HalfX[COLLISION_BATCH_SIZE];
+	float HalfY[COLLISION_BATCH_SIZE];
+	float VelocityX[COLLISION_BATCH_SIZE];
+	float VelocityY[COLLISION_BATCH_SIZE];
+	float TimeOfImpact[COLLISION_BATCH_SIZE];
+
+	uint32 Count;
+};
+
+void GatherBatch(CollisionBatch *batch, ColliderSoA *bodies, uint32 *indices, uint32 count);
+
+//NOTE(kai): bit i of the result is set when candidate i overlaps the box
+uint32 OverlapAABBBatch(float centerX, float centerY, float halfX, float halfY, CollisionBatch *batch);
+
+//NOTE(kai): bit i is set when the boxes can touch during the step, the same bounds the old swept test accepts.
+//			 TimeOfImpact[i] gets the slab entry time in [0, 1], or COLLISION_NO_IMPACT when the boxes don't meet
+uint32 SweptAABBBatch(float centerX, float centerY, float halfX, float halfY, float velocityX, float velocityY,
+					  CollisionBatch *batch);
+
+//NOTE(kai): exact sweep of a moving box against a resting one, only counts boxes it actually moves into.
+//			 the normal is on the side of the other box that gets hit, pointing back at the moving one
+bool SweptAABBTimeOfImpact(float centerX, float centerY, float halfX, float halfY, float motionX, float motionY,
+						   float otherX, float otherY, float otherHalfX, float otherHalfY,
+						   float *toi, float *normalX, float *normalY);
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <GL\glew.h>
+#include <thread>
+#include "Types.h"
+
+#define GL_STATE_TEXTURE_UNITS 8
+#define GL_STATE_UNKNOWN 0xFFFFFFFF
+
+//NOTE(kai): what the engine last told GL. Everything in the engine binds through these calls so a bind that
+//			 wouldn't change anything never reaches the driver. Anything that touches GL behind its back
+//			 (a new context, foreign code) has to call ResetGLState afterwards. Every thread has its own,
+//			 a thread only ever talks to the context it made current
+struct GLStateCache
+{
+	uint32 Program;
+	uint32 ArrayBuffer;
+	uint32 ElementBuffer;
+	uint32 VertexArray;
+
+	uint32 ActiveUnit;
+	uint32 Textures[GL_STATE_TEXTURE_UNITS];
+
+	//NOTE(kai): calls that went to GL and calls the cache dropped, cleared by ResetGLStateCounters
+	uint32 Issued;
+	uint32 Skipped;
+};
+
+GLStateCache* GetGLState();
+
+//NOTE(kai): forgets every binding so the next one always goes to GL
+void ResetGLState();
+
+void ResetGLStateCounters();
+
+void UseProgram(uint32 program);
+
+//NOTE(kai): only GL_ARRAY_BUFFER and GL_ELEMENT_ARRAY_BUFFER are tracked, other targets always go through
+void BindBuffer(uint32 target, uint32 buffer);
+
+//NOTE(kai): the element buffer binding belongs to the vertex array, it's forgotten when the vertex array changes
+void BindVertexArray(uint32 vertexArray);
+
+void BindTexture2D(uint32 unit, uint32 texture);
+
+//NOTE(kai): GL unbinds deleted objects itself, these keep the cache in step and zero the handle
+void DeleteBuffer(uint32 *buffer);
+void DeleteTexture(uint32 *texture);
+void DeleteProgram(uint32 *program);
+void DeleteVertexArray(uint32 *vertexArray);
+
+enum DEFERRED_OBJECT
+{
+	DEFERRED_BUFFER,
+	DEFERRED_TEXTURE,
+	DEFERRED_PROGRAM,
+	DEFERRED_VERTEX_ARRAY,
+};
+
+//NOTE(kai): a delete asked for by a thread that doesn't render, it waits until no snapshot still in flight can use it
+struct GLDeferredDelete
+{
+	uint32 Type;
+	uint32 Handle;
+	uint32 Frame;
+};
+
+//NOTE(kai): from now on deletes from any other thread are queued for thread. Vertex arrays aren't shared
+//			 between contexts, so they have to die on the thread that made them anyway
+void SetGLRenderThread(std::thread::id thread);
+
+//NOTE(kai): deletes run right away again, everything still queued is released on the calling thread
+void ClearGLRenderThread();
+
+//NOTE(kai): deletes queued from now on are stamped with frame, the first snapshot that can't be using them
+void SetDeferredDeleteFrame(uint32 frame);
+
+//NOTE(kai): render thread only, releases everything stamped with frame or earlier
+void ReleaseDeferredDeletes(uint32 frame);
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <GL\glew.h>
+#include "Types.h"
+
+//NOTE(kai): a pass's result is read this many frames after it was timed, by then the GPU is long done with it
+#define GPU_TIMER_FRAMES 4
+
+enum GPU_PASS
+{
+	GPU_PASS_TILE_MAPS,
+	GPU_PASS_SPRITES,
+	GPU_PASS_UI,
+	GPU_PASS_DEBUG,
+
+	GPU_PASS_COUNT,
+};
+
+//NOTE(kai): GL_TIME_ELAPSED queries around every pass, one set per frame in flight. Nothing ever waits on a result,
+//			 one that still isn't there when its set comes round again is dropped and the last time stays.
+//			 Query objects aren't shared between contexts, the timers belong to the thread that draws
+struct GpuTimers
+{
+	uint32 Queries[GPU_TIMER_FRAMES][GPU_PASS_COUNT];
+	bool Pending[GPU_TIMER_FRAMES][GPU_PASS_COUNT];
+
+	uint32 Frame;
+	int32 Running;
+
+	bool Created;
+	bool Supported;
+
+	//NOTE(kai): milliseconds, GPU_TIMER_FRAMES frames old
+	float PassTimes[GPU_PASS_COUNT];
+};
+
+//NOTE(kai): needs ARB_timer_query or GL 3.3, every call does nothing without it
+bool GpuTimersSupported();
+
+//NOTE(kai): collects the results of the frame whose queries are about to be used again, makes the queries the first time
+void BeginGpuFrame(GpuTimers *timers);
+
+//NOTE(kai): passes can't nest, GL only runs one time elapsed query at a time
+void BeginGpuPass(GpuTimers *timers, GPU_PASS pass);
+void EndGpuPass(GpuTimers *timers);
+
+//NOTE(kai): sum of the passes
+float GetGpuFrameTime(GpuTimers *timers);
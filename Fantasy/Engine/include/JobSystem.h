@@ -0,0 +1,46 @@
+#pragma once
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <condition_variable>
+#include "Types.h"
+
+#define MAX_JOB_THREADS 16
+
+//NOTE(kai): begin/end is the range of items to process, threadIndex is 0 for the calling thread
+typedef void JobCallback(void *data, uint32 begin, uint32 end, uint32 threadIndex);
+
+struct JobSystem
+{
+public:
+	//NOTE(kai): threadCount 0 means one worker for each core except the calling one
+	void Init(uint32 threadCount = 0);
+
+	void Destroy();
+
+	//NOTE(kai): blocks until every item is done, the calling thread works too
+	void ParallelFor(uint32 count, uint32 batchSize, JobCallback *callback, void *data);
+
+	uint32 GetThreadCount();
+private:
+	void WorkerLoop(uint32 threadIndex);
+
+	void RunBatches(uint32 threadIndex);
+private:
+	std::vector<std::thread> Workers;
+	std::mutex Lock;
+	std::condition_variable WorkReady;
+	std::condition_variable WorkDone;
+
+	JobCallback *Callback;
+	void *Data;
+	uint32 Count;
+	uint32 BatchSize;
+	std::atomic<uint32> NextItem;
+
+	uint32 Generation;
+	uint32 BusyWorkers;
+	bool Running;
+};
@@ -6,6 +6,8 @@
 #include <stdint.h>
 #include "Utilities.h"
 #include "Texture.h"
+#include "StreamBuffer.h"
+#include "VertexFormat.h"
 
 struct AnimationClip;
 struct GameObject;
@@ -19,6 +21,17 @@ enum ATTRIBUTE_INDEX
 	NORMALS = 4,
 };
 
+//NOTE(kai): a vertex array object and the buffers and offset its attribute layout was written for
+struct VertexLayout
+{
+	uint32 Handle;
+
+	uint32 VBO;
+	uint32 EBO;
+	uint32 BaseOffset;
+	VertexFormat *Format;
+};
+
 struct Mesh
 {
 	uint32 VBO;		
@@ -26,6 +39,10 @@ struct Mesh
 
 	uint32 VerticesCount;
 	uint32 IndicesCount;
+
+	//NOTE(kai): NULL means Vertex
+	VertexFormat *Format;
+	VertexLayout Layout;
 };
 
 enum BATCH_TYPE
@@ -35,9 +52,24 @@ enum BATCH_TYPE
 	CUBE_BATCH = 2
 };
 
+//NOTE(kai): 0 1 3, 1 2 3 for every quad, or its four edges when Lines is set. Written once and only rebuilt to grow
+struct QuadIndexBuffer
+{
+	uint32 Handle;
+	uint32 Capacity;
+	bool Lines;
+};
+
 struct MeshBatch
 {
-	Mesh Batch;
+	StreamBuffer Stream;
+	QuadIndexBuffer Indices;
+
+	//NOTE(kai): one per stream region, each region's vertices start at a different offset
+	VertexLayout Layouts[STREAM_BUFFER_FRAMES];
+
+	Vertex *Write;
+	uint32 WriteOffset;
 
 	uint32 MaxCount;
 	uint32 CurrentSize;
@@ -57,14 +89,31 @@ struct Sprite
 	vec3f Size;
 	Material Skin;
 	GameObject* Owner; 
-	Mesh Buffers;
+
+	//NOTE(kai): x, y, width, height in texture space, the animator moves it over the sheet
+	vec4f UVRect;
+	//NOTE(kai): the color the sprite is drawn with, starts as Skin.MeshColor
+	vec4f Color;
 };
 
 //Create the buffers and store the mesh data in them
 Mesh CreateMesh(Vertex *vertices, unsigned int verticesCount, unsigned int *indices, unsigned int indicesCount, bool withNormals = true, bool batch = false);
 
-//Bind the buffers
-void BindMesh(Mesh *mesh);
+//NOTE(kai): needs GL 3 or ARB_vertex_array_object, without it every bind sets the attributes up again
+bool VertexArraysSupported();
+
+//NOTE(kai): binds layout's vertex array and the mesh's vertex buffer. The attributes are only written when
+//			 the layout was made for other buffers or another baseOffset, so a mesh that was bound before costs one call
+void BindMeshLayout(VertexLayout *layout, Mesh *mesh, uint32 baseOffset = 0);
+
+//NOTE(kai): the next bind writes the attributes again, for when a buffer the layout points at was replaced
+void ResetMeshLayout(VertexLayout *layout);
+
+//NOTE(kai): goes before binding an element buffer that shouldn't end up in whatever vertex array is bound
+void UnbindVertexArray();
+
+//Bind the buffers, baseOffset is where the first vertex starts in the vertex buffer in bytes
+void BindMesh(Mesh *mesh, uint32 baseOffset = 0);
 
 //Unbind the buffers
 void UnbindMesh();
@@ -76,8 +125,12 @@ Mesh CreateSprite(vec3f pos, vec3f size, vec4f color, bool withNormals, bool deb
 
 void EditSprite(Mesh *sprite, vec3f pos, vec3f size, vec4f color);
 
+void EditSprite(Sprite *sprite, vec4f color);
+
 Mesh CreateCube(vec3f pos, vec3f size, vec4f color, bool withNormals = true);
 
+void ReserveQuadIndices(QuadIndexBuffer *indices, uint32 quadCount, bool lines);
+
 void CalculateNormals(Vertex *vertices, uint32 vertCount, unsigned int *indices, unsigned int indicesCount);
 void EditNormals(Mesh *buffers);
 
@@ -92,5 +145,3 @@ void AddSprite(MeshBatch *batch, vec3f pos, vec3f size, vec4f color, uint32 text
 void EndBatch(MeshBatch *batch, bool debug);
 
 void RenderBatch(MeshBatch *batch, bool debug);
-
-void DrawSprite(Sprite *sprite);
\ No newline at end of file
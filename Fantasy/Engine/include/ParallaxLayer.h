@@ -0,0 +1,34 @@
+#pragma once
+
+#include "GameComponent.h"
+#include "SceneManager.h"
+#include "Mesh.h"
+#include "RenderQueue.h"
+
+//NOTE(kai): far enough for any orthographic view, it only stops an unbounded view from asking for endless copies
+#define PARALLAX_MAX_COPIES 8
+
+//NOTE(kai): a sprite repeated along X without end, every other copy mirrored so the seams match. It drifts with
+//			 the camera by ScrollFactor, 0 stays put in the world, 1 sticks to the camera and negative values move
+//			 against it for things in front. The owner's position is where the first copy sits when the layer starts
+struct ParallaxLayer : public GameComponent
+{
+public:
+	ParallaxLayer(char *name, Sprite sprite, float scrollFactor, uint8 renderLayer = RENDER_LAYER_BACKGROUND);
+
+public:
+	virtual void PreInit();
+
+	virtual void Init();
+
+public:
+	Sprite SpriteData;
+	float ScrollFactor;
+	uint8 RenderLayer;
+
+	vec3f Origin;
+	float CameraStart;
+};
+
+//NOTE(kai): pushes the copies that overlap view with order, returns how many
+uint32 PushParallaxLayer(RenderQueue *queue, ParallaxLayer *layer, BoundingRect *view, float cameraX, uint32 order);
@@ -1,6 +1,13 @@
 #pragma once
 
 #include <Collider.h>
+#include <Broadphase.h>
+#include <CollisionBatch.h>
+#include <JobSystem.h>
+
+#define MAX_COLLISION_LAYERS 32
+
+struct TileCollider;
 
 struct CollisionFlags
 {
@@ -20,6 +27,70 @@ struct CollidedPair
 	char *Name2;
 };
 
+#define CONTACT_NONE 0
+#define CONTACT_X 1
+#define CONTACT_Y 2
+
+#define CONTACT_TOUCH_NONE 0
+#define CONTACT_TOUCH_A 1
+#define CONTACT_TOUCH_BOTH 2
+
+//NOTE(kai): everything the swept test found out about a hit, nothing is written until it's resolved
+struct Contact
+{
+	Collider *A;
+	Collider *B;
+
+	uint32 Order;
+
+	uint32 Axis;
+	bool Positive;
+	vec2f Correction;
+
+	uint32 Touch;
+	vec2f Normal;
+	float Penetration;
+};
+
+#define QUERY_ALL_LAYERS 0xFFFFFFFF
+
+//NOTE(kai): counts for the last Update, summed over its steps
+struct PhysicsStats
+{
+	uint32 Steps;
+	uint32 Proxies;
+	uint32 BroadphasePairs;
+	uint32 ContactsFound;
+	uint32 ContactsResolved;
+	uint32 Sweeps;
+	uint32 Sleeping;
+};
+
+struct RaycastQuery
+{
+	vec2f Origin;
+	vec2f Direction;
+	float MaxDistance;
+	uint32 LayerMask;
+	Collider *Ignore;
+};
+
+struct RaycastHit
+{
+	Collider *Hit;
+	vec2f Point;
+	vec2f Normal;
+	float Distance;
+};
+
+struct NearestQuery
+{
+	vec2f Point;
+	float MaxDistance;
+	uint32 LayerMask;
+	Collider *Ignore;
+};
+
 struct PhysicsEngine
 {
 public:
@@ -28,12 +99,135 @@ public:
 	Physics ph;
 	SceneManager *Scene = 0;
 
+	Broadphase BPhase;
+	std::vector<BroadphasePair> Pairs;
+
+	ColliderSoA Bodies;
+	std::vector<uint32> CandidateStart;
+	std::vector<uint32> CandidateCursor;
+	std::vector<uint32> Candidates;
+
+	std::vector<Contact> ThreadContacts[MAX_JOB_THREADS];
+	std::vector<Contact> Contacts;
+
+	//NOTE(kai): proxies of continuous colliders that moved far enough to tunnel this tick
+	std::vector<uint8> Sweeping;
+	std::vector<vec2f> PathStart;
+	std::vector<uint32> SweepTriggers;
+	float ContinuousSkin;
+	uint32 ContinuousIterations;
+
+	//NOTE(kai): a collider moving less than SleepVelocity a tick for SleepTicks ticks goes to sleep
+	float SleepVelocity;
+	uint32 SleepTicks;
+
+	//NOTE(kai): Update steps the world FixedDelta at a time, each step split into Substeps.
+	//			 Alpha is how far the leftover time is into the next step, for interpolating
+	float FixedDelta;
+	uint32 Substeps;
+	uint32 MaxSteps;
+	float Accumulator;
+	float Alpha;
+
+	//NOTE(kai): units per second squared
+	vec2f Gravity;
+
+	PhysicsStats Stats;
+
+	//NOTE(kai): tile rects skip the sort, each moving collider looks up the cells under it instead
+	std::vector<TileCollider *> TileColliders;
+	std::vector<TileCollider *> ActiveTileColliders;
+	std::vector<uint32> TileRects;
+
+	//NOTE(kai): exact boxes where the last update left the colliders, the spatial queries run against these
+	Broadphase QueryIndex;
+	std::vector<uint32> QueryCandidates[MAX_JOB_THREADS];
+
+	//NOTE(kai): reused by every collider's ground check each tick so it doesn't allocate
+	std::vector<Collider *> GroundCandidates;
+
+	char *LayerNames[MAX_COLLISION_LAYERS];
+	uint32 LayerMatrix[MAX_COLLISION_LAYERS];
+	uint32 LayerCount;
+
 public:
 	void Init();
 
-	void Update();
+	void Update(float delta);
+
+	bool SweptAABBvsAABB(Collider *A, Collider *B);
+
+	bool DetectSweptAABB(Collider *A, Collider *B, Contact *contact);
 
-	bool SweptAABBvsAABB(Collider *A, Collider *B, float delta);
+	void ResolveContact(Contact *contact);
+
+	void DetectContacts(uint32 begin, uint32 end, uint32 threadIndex);
 
 	bool AABBvsAABB(Collider *A, Collider *B);
+
+	uint32 AddLayer(char *name);
+
+	uint32 GetLayerBits(char *name);
+
+	void SetLayerCollision(char *layer1, char *layer2, bool collide);
+
+	uint32 GetLayerMask(uint32 layerBits);
+
+	void WakeCollider(Collider *collider);
+
+	void RemoveCollider(Collider *collider);
+
+	void AddTileCollider(TileCollider *tiles);
+
+	void RemoveTileCollider(TileCollider *tiles);
+
+	//NOTE(kai): the tile rects touching a box, for the tests that don't go through Update
+	void FindTileColliders(float minX, float minY, float maxX, float maxY, std::vector<Collider *> *result);
+
+	bool Raycast(vec2f origin, vec2f direction, float maxDistance, RaycastHit *hit,
+				 uint32 layerMask = QUERY_ALL_LAYERS, Collider *ignore = NULL);
+
+	uint32 OverlapBox(vec2f center, vec2f halfSize, std::vector<Collider *> *result, uint32 layerMask = QUERY_ALL_LAYERS);
+
+	uint32 OverlapCircle(vec2f center, float radius, std::vector<Collider *> *result, uint32 layerMask = QUERY_ALL_LAYERS);
+
+	//NOTE(kai): nearest by distance between centers, NULL when nothing is within maxDistance
+	Collider* Nearest(vec2f point, float maxDistance, uint32 layerMask, Collider *ignore = NULL, float *distance = NULL);
+
+	//NOTE(kai): the batch versions spread the queries over the job system, hits[i] answers queries[i]
+	void RaycastBatch(RaycastQuery *queries, RaycastHit *hits, uint32 count);
+
+	void NearestBatch(NearestQuery *queries, Collider **results, uint32 count);
+
+	void RunRaycasts(RaycastQuery *queries, RaycastHit *hits, uint32 begin, uint32 end, uint32 threadIndex);
+
+	void RunNearest(NearestQuery *queries, Collider **results, uint32 begin, uint32 end, uint32 threadIndex);
+private:
+	bool UpdateSleep(Collider *collider);
+
+	void Step(float h, bool firstStep);
+
+	void Integrate(Collider *collider, float h);
+
+	BroadphaseProxy MakeProxy(Collider *collider, bool sweeping, bool resting, vec2f start);
+
+	bool NeedsSweep(Collider *collider, vec2f start);
+
+	void SweepContinuous(uint32 index);
+
+	void ReportSweepTrigger(Collider *A, Collider *B, uint32 candidate);
+
+	void ApplySweepHit(Collider *A, Collider *hit, float normalX, float normalY);
+
+	void BuildCandidates();
+
+	void AddCollidedPair(Collider *collider1, Collider *collider2);
+
+	void BuildQueryIndex();
+
+	void AddTilePairs();
+
+	bool RaycastIndex(RaycastQuery *query, RaycastHit *hit, uint32 threadIndex);
+
+	Collider* NearestIndex(NearestQuery *query, float *distance, uint32 threadIndex);
 };
\ No newline at end of file
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <vector>
+#include "Mesh.h"
+
+//NOTE(kai): layers always draw in this order, whatever the depth. Gaps are left so games can slot
+//			 their own in between, e.g. RENDER_LAYER_BACKGROUND + 1
+enum RENDER_LAYER
+{
+	RENDER_LAYER_BACKGROUND = 0,
+	RENDER_LAYER_WORLD = 64,
+	RENDER_LAYER_FOREGROUND = 128,
+	RENDER_LAYER_UI = 192,
+};
+
+//NOTE(kai): from the top bit down: layer 8, depth 24, translucent 1, texture 31. Sprites with the same
+//			 layer and depth are grouped by texture, so anything that has to overlap in a set order at
+//			 the same z needs its own layer
+struct RenderKey
+{
+	uint64 Key;
+	uint32 Item;
+
+	//NOTE(kai): what the item was pushed for, equal keys from different queues merge in this order
+	uint32 Order;
+};
+
+struct RenderItem
+{
+	Sprite *SpriteData;
+	mat4f Model;
+	uint8 Layer;
+};
+
+struct RenderQueue
+{
+	std::vector<RenderItem> Items;
+
+	std::vector<RenderKey> Keys;
+	std::vector<RenderKey> Scratch;
+};
+
+uint64 MakeSortKey(uint8 layer, float depth, bool translucent, uint32 texture);
+
+void ClearRenderQueue(RenderQueue *queue);
+
+//NOTE(kai): order has to go up with every push to the same queue
+void PushRenderItem(RenderQueue *queue, Sprite *sprite, mat4f *model, uint8 layer, uint32 order);
+
+//NOTE(kai): least significant byte first, stable so equal keys keep the order they were pushed in
+void RadixSortKeys(RenderKey *keys, RenderKey *scratch, uint32 count);
+
+//NOTE(kai): Keys ends up in draw order, each one points into Items
+void SortRenderQueue(RenderQueue *queue);
+
+//NOTE(kai): sorted queues into one draw order, by key and then by order. The same items always come out in
+//			 the same order however they were spread over the queues
+void MergeRenderQueues(RenderQueue *queues, uint32 count, std::vector<RenderItem *> *merged);
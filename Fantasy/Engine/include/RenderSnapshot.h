@@ -0,0 +1,110 @@
+#pragma once
+
+#include <GL\glew.h>
+#include <vector>
+#include <mutex>
+#include <condition_variable>
+#include "Types.h"
+#include "Mesh.h"
+#include "Camera.h"
+#include "GpuTimer.h"
+
+#define RENDER_SNAPSHOT_SLOTS 3
+
+//NOTE(kai): a sprite in draw order, copied out of its renderer so the update thread is free to change or remove it
+struct SnapshotSprite
+{
+	Sprite SpriteData;
+	mat4f Model;
+};
+
+//NOTE(kai): a visible tile map chunk, its vertices were uploaded before the snapshot went out
+struct SnapshotChunk
+{
+	uint32 VBO;
+	uint32 EBO;
+	uint32 QuadCount;
+	uint32 Texture;
+};
+
+struct SnapshotBox
+{
+	vec3f Pos;
+	vec2f Size;
+};
+
+//NOTE(kai): everything one frame draws. The render thread only ever looks at this, never at the scene
+struct RenderSnapshot
+{
+	uint32 Frame;
+
+	//NOTE(kai): the camera as it was when the snapshot was taken
+	mat4f Projection;
+	mat4f View;
+	BoundingRect ViewRect;
+
+	std::vector<SnapshotChunk> Chunks;
+
+	//NOTE(kai): everything from UIStart on is on RENDER_LAYER_UI or above and draws as its own pass
+	std::vector<SnapshotSprite> Sprites;
+	uint32 UIStart;
+
+	bool Debug;
+	std::vector<SnapshotBox> DebugBoxes;
+
+	//NOTE(kai): set after the update thread's own GL work for the frame (texture loads, chunk uploads) when it
+	//			 has a context of its own, the render thread waits on it before drawing
+	GLsync Fence;
+};
+
+//NOTE(kai): the last frame drawn, the GPU times are GPU_TIMER_FRAMES frames older than that
+struct RenderStats
+{
+	float GpuPassTimes[GPU_PASS_COUNT];
+	float GpuFrameTime;
+};
+
+//NOTE(kai): the update thread fills Writing and swaps it with Ready, the render thread swaps Ready with Reading
+//			 when there's something new, so neither ever waits for the other to finish a frame. A snapshot the
+//			 render thread didn't get to in time goes back to the update thread and is overwritten
+struct RenderSnapshotBuffer
+{
+	RenderSnapshot Slots[RENDER_SNAPSHOT_SLOTS];
+
+	uint32 Writing;
+	uint32 Ready;
+	uint32 Reading;
+
+	bool Fresh;
+	bool Closed;
+
+	uint32 NextFrame;
+
+	//NOTE(kai): what the render thread hands back, written and read under Lock like the slot indices
+	RenderStats Stats;
+	uint32 DrawnFrames;
+
+	std::mutex Lock;
+	std::condition_variable Published;
+};
+
+void InitSnapshotBuffer(RenderSnapshotBuffer *buffer);
+
+//NOTE(kai): update thread, the snapshot to fill. It may be one that was never drawn, nothing in it is worth keeping
+RenderSnapshot* BeginSnapshot(RenderSnapshotBuffer *buffer);
+
+//NOTE(kai): hands the filled snapshot over and moves the deferred GL deletes on to the next frame
+void PublishSnapshot(RenderSnapshotBuffer *buffer);
+
+//NOTE(kai): render thread, waits up to timeout milliseconds for a snapshot newer than the last one. NULL when
+//			 none came or the buffer was closed
+RenderSnapshot* AcquireSnapshot(RenderSnapshotBuffer *buffer, uint32 timeout);
+
+//NOTE(kai): render thread, after each frame it draws
+void PublishRenderStats(RenderSnapshotBuffer *buffer, RenderStats *stats);
+
+//NOTE(kai): copies the latest stats out and returns how many frames were drawn since the last call
+uint32 TakeRenderStats(RenderSnapshotBuffer *buffer, RenderStats *stats);
+
+//NOTE(kai): wakes the render thread for good, AcquireSnapshot returns NULL from then on
+void CloseSnapshotBuffer(RenderSnapshotBuffer *buffer);
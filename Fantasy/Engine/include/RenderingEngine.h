@@ -5,6 +5,16 @@
 #include "Shader.h"
 #include "Mesh.h"
 #include "Texture.h"
+#include "SpriteBatch.h"
+#include "RenderQueue.h"
+#include "RenderSnapshot.h"
+#include "JobSystem.h"
+#include "GpuTimer.h"
+#include "TileMapRenderer.h"
+#include "ParallaxLayer.h"
+
+//NOTE(kai): how long a frame can take at 60 FPS, the debug overlay draws it as a quarter of the view
+#define GPU_OVERLAY_BUDGET 16.6f
 
 struct RenderingEngine
 {
@@ -16,21 +26,76 @@ public:
 	~RenderingEngine(){}
 public:
 	void Init();
-	
-	void Render();
-	void Update();
 
-	void DebugRender();
+	//NOTE(kai): the update side. Culls and sorts the scene into snapshot without drawing anything, only the
+	//			 dirty tile map chunks it finds are uploaded. The collider boxes only go in with debug
+	void CaptureSnapshot(RenderSnapshot *snapshot, bool debug);
+
+	//NOTE(kai): the render side, tile maps first, then the sprites, then the debug boxes. Nothing but the snapshot is read
+	void DrawSnapshot(RenderSnapshot *snapshot);
+
 	void DebugUpdate();
 
 	void InitShader(char *vertexShader, char *fragmentShader);
 	void InitDebugShader(char *vertexShader, char *fragmentShader);
 
+	//NOTE(kai): optional, sprites go through the instanced path when this is set up and the driver has instancing
+	void InitInstancedShader(char *vertexShader, char *fragmentShader);
+
+	//NOTE(kai): one job's share of the renderers, into the calling thread's queue
+	void CullRenderers(std::vector<GameComponent *> *renderers, BoundingRect *view, uint32 begin, uint32 end, uint32 threadIndex);
+
+private:
+	void CaptureTileMaps(RenderSnapshot *snapshot, BoundingRect *view);
+	void CaptureSprites(RenderSnapshot *snapshot, BoundingRect *view);
+	void CaptureDebugBoxes(RenderSnapshot *snapshot);
+
+	void DrawTileChunks(RenderSnapshot *snapshot);
+	//NOTE(kai): snapshot sprites first up to end, each pass has its own batches so each uploads once a frame
+	void DrawSprites(RenderSnapshot *snapshot, uint32 first, uint32 end, SpriteBatch *sprites, SpriteInstanceBatch *instances);
+	void DrawDebugBoxes(RenderSnapshot *snapshot);
+
 public:
 	Shader MainShader = {};
 	Shader DebugShader = {};
+	Shader InstancedShader = {};
 
 	MeshBatch DebugBatch = {};
+	SpriteBatch Sprites = {};
+	SpriteInstanceBatch Instances = {};
+
+	SpriteBatch UISprites = {};
+	SpriteInstanceBatch UIInstances = {};
+
+	//NOTE(kai): the renderers are culled and keyed in parallel, each job thread into its own queue and counts.
+	//			 The queues are sorted on their own threads and merged into Merged
+	RenderQueue ThreadQueues[MAX_JOB_THREADS];
+	uint32 ThreadVisible[MAX_JOB_THREADS];
+	uint32 ThreadCulled[MAX_JOB_THREADS];
+	std::vector<RenderItem *> Merged;
+
+	//NOTE(kai): every tile map chunk goes through this one, chunks live in snapshots and can't keep a vertex array
+	VertexLayout ChunkLayout = {};
+
+	//NOTE(kai): what SceneManager::Render captures into and draws when there's no render thread
+	RenderSnapshot Frame = {};
+
+	//NOTE(kai): set when snapshots are drawn on another thread with its own context, capturing then fences the
+	//			 update thread's GL work so the render thread doesn't read half finished uploads
+	bool Threaded = false;
+
+	//NOTE(kai): owned by whichever thread draws the snapshots, Stats gets a copy of the times every frame.
+	//			 With a render thread, other threads read them through PublishRenderStats/TakeRenderStats
+	GpuTimers Timers = {};
+	RenderStats Stats = {};
+
+	//NOTE(kai): last frame's renderers inside and outside the camera's view
+	uint32 VisibleSprites = 0;
+	uint32 CulledSprites = 0;
+
+	//NOTE(kai): same for the tile map chunks
+	uint32 VisibleChunks = 0;
+	uint32 CulledChunks = 0;
 
 	SceneManager *Scene = 0;
 };
@@ -2,6 +2,7 @@
 
 #include <unordered_map>
 #include "Texture.h"
+#include "TextureAtlas.h"
 #include <SDL2\SDL.h>
 #include <SDL_mixer.h>
 #include <FreeImage.h>
@@ -18,6 +19,9 @@ public:
 	std::unordered_map<char *, Texture> TextureResources;
 	std::unordered_map<char *, Mix_Chunk *> SoundResources;
 	std::unordered_map<char *, Mix_Music *> BGMResources;
+
+	//NOTE(kai): small images loaded through LoadAtlasTexture share its pages
+	TextureAtlas Atlas;
 };
 
 void AddTexture(Game_Resources *resources, Texture texture, char *name);
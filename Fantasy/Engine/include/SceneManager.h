@@ -6,6 +6,8 @@
 #include "Transform.h"
 #include "RenderingEngine.h"
 #include "PhysicsEngine.h"
+#include "JobSystem.h"
+#include "AnimationSystem.h"
 #include "GameData.h"
 
 struct SceneManager
@@ -32,6 +34,11 @@ public:
 	void Render();
 	void Update(float delta, Game_Input *input);
 
+	//NOTE(kai): Render split in two for a separate render thread, the first runs with the updates and the second
+	//			 only touches the snapshot
+	void CaptureFrame(RenderSnapshot *snapshot);
+	void RenderFrame(RenderSnapshot *snapshot);
+
 	GameComponent* AddComponent(GameComponent *component);
 	void AddComponentPool(GameComponent *component);
 	
@@ -66,8 +73,10 @@ private:
 	Cinder::Memory::MemoryPool ObjectPool;
 	bool Debug;
 public:
+	JobSystem Jobs;
 	PhysicsEngine PEngine;
 	RenderingEngine REngine;
+	AnimationSystem Animations;
 	Game_Input *Input;
 	BasicCamera MainCamera;
 	float Delta;
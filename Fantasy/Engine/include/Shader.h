@@ -1,8 +1,13 @@
 #pragma once
 
 #include <GL\glew.h>
+#include <Cinder\CinderMath.h>
 #include "Utilities.h"
 #include "Types.h"
+#include "GLState.h"
+#include "VertexFormat.h"
+
+using namespace Cinder::Math;
 
 #define MAX_NUMBER 100
 
@@ -17,6 +22,8 @@ enum UNIFORMS
 	DEBUG
 };
 
+#define CACHED_UNIFORMS (DEBUG + 1)
+
 enum ShaderType
 {
 	FRAGMENT_SHADER = 0,
@@ -29,6 +36,10 @@ struct Shader
 	unsigned int ProgramHandle;
 
 	unsigned int UniformLocations[MAX_NUMBER];
+
+	//NOTE(kai): the last value sent to each uniform, bit n of CachedUniforms says slot n holds one
+	float UniformValues[CACHED_UNIFORMS][16];
+	uint32 CachedUniforms;
 };
 
 
@@ -39,6 +50,10 @@ unsigned int GetUniformLocation(Shader *shader, UNIFORMS uniformType);
 
 void AddUniform(Shader *shader, UNIFORMS type, char *name);
 
+//NOTE(kai): both make the shader current and skip the upload when the uniform already holds the value
+void SetUniformMatrix(Shader *shader, UNIFORMS uniformType, mat4f *matrix);
+void SetUniformInt(Shader *shader, UNIFORMS uniformType, int value);
+
 //NOTE(kai): We create a shader by:
 //					1) Generating a handle for the shader
 //					2) Storing the shader code into the shader
@@ -52,6 +67,9 @@ void AddUniform(Shader *shader, UNIFORMS type, char *name);
 //Create a shader  
 Shader CreateShader(char *vertexPath, char *fragmentPath, char **attributeLocations = 0, uint32 attributeLocationCount = 0);
 
+//NOTE(kai): binds the format's attribute names to the locations SetVertexAttributes feeds
+Shader CreateShader(char *vertexPath, char *fragmentPath, VertexFormat *format);
+
 
 //Add a shader into the program  
 void AddShader(Shader *shader, char *path, ShaderType type);
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <vector>
+#include "Mesh.h"
+#include "StreamBuffer.h"
+
+enum SPRITE_INSTANCE_ATTRIBUTE
+{
+	INSTANCE_CORNER = 0,
+	INSTANCE_AXES = 1,
+	INSTANCE_ORIGIN = 2,
+	INSTANCE_UV_RECT = 3,
+	INSTANCE_COLOR = 4,
+};
+
+//NOTE(kai): sprites next to each other in submission order that share a texture, one draw call each
+struct SpriteBatchRun
+{
+	uint32 TextureHandle;
+	uint32 First;
+	uint32 Count;
+};
+
+//NOTE(kai): quads are transformed on the CPU straight into the stream buffer as SpriteVertex, the index buffer
+//			 never changes since every quad uses the same 0 1 3, 1 2 3 pattern
+struct SpriteBatch
+{
+	StreamBuffer Stream;
+	QuadIndexBuffer Indices;
+
+	VertexLayout Layouts[STREAM_BUFFER_FRAMES];
+
+	SpriteVertex *Write;
+	uint32 WriteOffset;
+	uint32 MaxCount;
+
+	std::vector<SpriteBatchRun> Runs;
+
+	uint32 SpriteCount;
+	uint32 DrawCalls;
+};
+
+//NOTE(kai): maxCount is how many sprites can be added before the batch ends
+void BeginSpriteBatch(SpriteBatch *batch, uint32 maxCount);
+
+void AddSpriteToBatch(SpriteBatch *batch, Sprite *sprite, mat4f *model);
+
+//NOTE(kai): uploads the frame's quads and draws every run, the shader's model matrix has to be identity
+void EndSpriteBatch(SpriteBatch *batch);
+
+//NOTE(kai): 44 bytes for a whole sprite against four 16 byte sprite vertices, the shader builds the
+//			 corners from the shared unit quad
+struct SpriteInstance
+{
+	//NOTE(kai): the sprite's x axis then its y axis, both already scaled by the size
+	float Axes[4];
+	//NOTE(kai): center x, y, z and the texture array layer, the layer stays 0 until textures live in array pages
+	float Origin[4];
+	//NOTE(kai): x, y, width, height normalized to 0..65535
+	uint16 UVRect[4];
+	uint8 Color[4];
+};
+
+struct SpriteInstanceBatch
+{
+	uint32 QuadVBO;
+	uint32 QuadEBO;
+
+	//NOTE(kai): holds the corner attribute, the index buffer and the divisors. The instance pointers move
+	//			 with every run so they are still set per draw
+	uint32 VertexArray;
+
+	StreamBuffer Stream;
+	SpriteInstance *Write;
+	uint32 WriteOffset;
+	uint32 MaxCount;
+
+	std::vector<SpriteBatchRun> Runs;
+
+	uint32 SpriteCount;
+	uint32 DrawCalls;
+};
+
+//NOTE(kai): needs ARB_instanced_arrays, the CPU batch is the fallback when it's missing
+bool InstancingSupported();
+
+void BeginInstanceBatch(SpriteInstanceBatch *batch, uint32 maxCount);
+
+void AddSpriteInstance(SpriteInstanceBatch *batch, Sprite *sprite, mat4f *model);
+
+void EndInstanceBatch(SpriteInstanceBatch *batch);
@@ -3,15 +3,20 @@
 #include "GameComponent.h"
 #include "SceneManager.h"
 #include "Mesh.h"
+#include "RenderQueue.h"
 
 struct SpriteRenderer
 	: public GameComponent
 {
-	SpriteRenderer(char *name, Sprite sprite, char *type = "RENDERABLE")
+	SpriteRenderer(char *name, Sprite sprite, uint8 renderLayer = RENDER_LAYER_WORLD, char *type = "RENDERABLE")
 	{
 		this->Name = name;
 		this->Type = type;
 		this->SpriteData = sprite;
+		this->SpriteData.UVRect = vec4f(0, 0, 1, 1);
+		this->SpriteData.Color = sprite.Skin.MeshColor;
+		this->RenderLayer = renderLayer;
+		this->BoundsValid = false;
 		this->Size = sizeof(SpriteRenderer);
 	}
 	
@@ -22,10 +27,7 @@ struct SpriteRenderer
 
 	virtual void Init()
 	{
-		if (!SpriteData.Buffers.VBO)
-		{
-			SpriteData.Buffers = CreateSprite(SpriteData.Pos, SpriteData.Size, SpriteData.Skin.MeshColor, false, false);
-		}
+	
 	}
 	virtual void Destroy(){}
 	virtual void Update(float delta, Game_Input *input)
@@ -33,13 +35,24 @@ struct SpriteRenderer
 	
 	}
 
+	//NOTE(kai): RenderingEngine::Render batches every renderer, nothing is drawn one by one
 	virtual void Render()
 	{				
-		BindTexture(&SpriteData.Skin.MeshTexture);
-		DrawMesh(&SpriteData.Buffers, false);
-		UnbindTexture();
+	
 	}
 
 	Sprite SpriteData;	
+	uint8 RenderLayer;
+
+	//NOTE(kai): world model matrix and box from the last frame, only rebuilt when the values below change
+	mat4f CachedModel;
+	BoundingRect WorldBounds;
+
+	vec3f CachedPosition;
+	vec3f CachedRotation;
+	vec3f CachedScale;
+	vec3f CachedSpritePos;
+	vec3f CachedSpriteSize;
+	bool BoundsValid;
 };
 
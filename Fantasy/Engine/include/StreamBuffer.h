@@ -0,0 +1,41 @@
+#pragma once
+
+#include <GL\glew.h>
+#include <vector>
+#include "Types.h"
+#include "GLState.h"
+
+#define STREAM_BUFFER_FRAMES 3
+
+//NOTE(kai): one GL buffer cut into STREAM_BUFFER_FRAMES regions so the CPU fills one while the GPU still reads
+//			 the others. With ARB_buffer_storage it stays mapped for good and a fence per region says when the
+//			 GPU is done with it, without it the writes go to Staging and EndStream orphans and uploads them
+struct StreamBuffer
+{
+	uint32 Handle;
+	uint32 Target;
+	uint32 RegionSize;
+	uint32 Region;
+
+	uint8 *Mapped;
+	GLsync Fences[STREAM_BUFFER_FRAMES];
+
+	std::vector<uint8> Staging;
+
+	bool Persistent;
+};
+
+//NOTE(kai): size is in bytes per frame, the buffer only ever grows. Returns true when a new GL buffer was
+//			 made, anything that still points at the old handle has to be rebuilt
+bool ReserveStream(StreamBuffer *stream, uint32 target, uint32 size);
+
+void DestroyStream(StreamBuffer *stream);
+
+//NOTE(kai): returns where this frame's data goes, offset gets its position in the GL buffer in bytes
+void* BeginStream(StreamBuffer *stream, uint32 *offset);
+
+//NOTE(kai): size is how much was written, the buffer is left bound to its target
+void EndStream(StreamBuffer *stream, uint32 size);
+
+//NOTE(kai): goes after the last draw that reads this frame's region
+void FenceStream(StreamBuffer *stream);
@@ -1,15 +1,24 @@
 #pragma once
 
 #include <GL\glew.h>
+#include <Cinder\CinderMath.h>
 #include <iostream>
 #include "Types.h"
 #include "Utilities.h"
+#include "GLState.h"
+
+using namespace Cinder::Math;
 
 struct Texture
 {
 	unsigned int TextureHandle;	
 	unsigned long Width;
 	unsigned long Height;
+
+	//NOTE(kai): where the image sits in TextureHandle, x, y, width, height normalized. Only used when
+	//			 Packed is set so a zeroed Texture still means the whole texture
+	vec4f Region;
+	bool Packed;
 };
 
 struct Material
@@ -21,8 +30,14 @@ struct Material
 
 ////
 
+//NOTE(kai): pixels are 32 bit BGRA rows from the bottom up, the way FreeImage hands them out
+Texture CreateTexture(uint32 width, uint32 height, void *pixels);
+
 Texture LoadTexture(char *imagePath);
 
+//NOTE(kai): maps a uv rect in image space to where the image really is in its texture
+vec4f TextureRegionUV(Texture *texture, vec4f uvRect);
+
 void BindTexture(Texture *texture);
 void UnbindTexture();
 
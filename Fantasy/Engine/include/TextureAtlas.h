@@ -0,0 +1,41 @@
+#pragma once
+
+#include <vector>
+#include "Texture.h"
+
+#define ATLAS_PAGE_SIZE 2048
+#define ATLAS_MAX_IMAGE_SIZE 1024
+#define ATLAS_PADDING 2
+
+//NOTE(kai): one segment of a page's top outline, everything under it is taken
+struct SkylineNode
+{
+	uint32 X;
+	uint32 Y;
+	uint32 Width;
+};
+
+struct AtlasPage
+{
+	uint32 TextureHandle;
+
+	std::vector<SkylineNode> Skyline;
+};
+
+//NOTE(kai): images are packed as they get loaded into GL_TEXTURE_2D pages so the GLSL 120 shaders can
+//			 sample them as they are. Anything bigger than ATLAS_MAX_IMAGE_SIZE keeps its own texture,
+//			 a single sprite sheet would fill most of a page on its own
+struct TextureAtlas
+{
+	uint32 PageSize;
+
+	std::vector<AtlasPage> Pages;
+};
+
+//NOTE(kai): returns a Packed texture that points at the page, or a plain one when the image doesn't fit
+Texture LoadAtlasTexture(TextureAtlas *atlas, char *imagePath);
+
+//NOTE(kai): bottom left skyline, x and y get the spot for a width by height rect on success
+bool PackSkyline(std::vector<SkylineNode> *skyline, uint32 pageSize, uint32 width, uint32 height, uint32 *x, uint32 *y);
+
+void DestroyAtlas(TextureAtlas *atlas);
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <Collider.h>
+#include <TileMap.h>
+
+//NOTE(kai): every code but 0
+#define TILE_SOLID_DEFAULT 0x3FE
+#define TILE_NO_RECT 0xFFFFFFFF
+
+//NOTE(kai): collision for a whole tile map, the solid tiles are merged into a few static rects when it's loaded
+//			 and the physics engine finds them through the grid instead of sorting them with everything else.
+//			 the owner's position is the top left corner of the map
+struct TileCollider : public GameComponent
+{
+public:
+	TileCollider(char *name, char *path, vec2f tileSize, uint32 solidCodes = TILE_SOLID_DEFAULT);
+
+public:
+	virtual void Init();
+
+	virtual void Destroy();
+
+	//NOTE(kai): appends the index of every rect under the cells the box touches, each one once
+	void FindRects(float minX, float minY, float maxX, float maxY, std::vector<uint32> *result);
+public:
+	char *Path;
+	vec2f TileSize;
+	vec2f Origin;
+	uint32 SolidCodes;
+
+	TileMap *Map;
+	std::vector<TileRect> *Rects;
+	std::vector<Collider> *Colliders;
+	std::vector<vec3f> *Centers;
+
+	//NOTE(kai): the rect covering each cell, or TILE_NO_RECT
+	std::vector<uint32> *CellRects;
+	std::vector<uint32> *RectStamps;
+	uint32 Stamp;
+
+	//NOTE(kai): where the rects start in the broadphase proxies this tick
+	uint32 ProxyBase;
+};
\ No newline at end of file
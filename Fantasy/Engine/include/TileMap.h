@@ -0,0 +1,42 @@
+#pragma once
+
+#include <vector>
+#include "Types.h"
+
+//NOTE(kai): 'TMAP' read as a little endian uint32
+#define TILE_MAP_MAGIC 0x50414D54
+
+//NOTE(kai): a grid of tile codes, row 0 is the first line of a text map or the first row of a binary one
+struct TileMap
+{
+	uint32 Width;
+	uint32 Height;
+	std::vector<uint8> Tiles;
+};
+
+//NOTE(kai): a binary map is this header followed by Width * Height one byte codes, row by row
+struct TileMapHeader
+{
+	uint32 Magic;
+	uint32 Width;
+	uint32 Height;
+};
+
+//NOTE(kai): a block of solid tiles, in tiles from the top left corner of the map
+struct TileRect
+{
+	uint32 X, Y;
+	uint32 Width, Height;
+};
+
+//NOTE(kai): files that start with TILE_MAP_MAGIC load as binary, anything else as rows of digits
+bool LoadTileMap(char *path, TileMap *map);
+
+uint8 GetTile(TileMap *map, uint32 x, uint32 y);
+
+//NOTE(kai): bit n of solidCodes set means tiles with code n are solid
+bool IsSolidTile(TileMap *map, uint32 x, uint32 y, uint32 solidCodes);
+
+//NOTE(kai): greedy merge, each rect grows right along its row and then down for as long as the
+//			 rows below are solid under its whole width, so every solid tile ends up in exactly one rect
+void MergeSolidTiles(TileMap *map, uint32 solidCodes, std::vector<TileRect> *rects);
\ No newline at end of file
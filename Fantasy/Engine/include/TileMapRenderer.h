@@ -0,0 +1,61 @@
+#pragma once
+
+#include "GameComponent.h"
+#include "SceneManager.h"
+#include "Mesh.h"
+#include "TileMap.h"
+
+#define TILE_CHUNK_SIZE 32
+
+//NOTE(kai): binary maps can leave cells out with this code, it's never drawn
+#define TILE_EMPTY 0xFF
+
+//NOTE(kai): the quads of up to TILE_CHUNK_SIZE x TILE_CHUNK_SIZE tiles in one static buffer, already in world space
+struct TileChunk
+{
+	uint32 VBO;
+	uint32 QuadCount;
+
+	BoundingRect Bounds;
+	bool Dirty;
+};
+
+//NOTE(kai): draws a tile map from a tileset laid out as a grid, tile code n uses cell n counting left to right
+//			 from the top row. The map is cut into chunks that are culled against the camera and only rebuilt
+//			 when one of their tiles changes. The owner's position is the top left corner of the map, like TileCollider.
+//			 Tile maps go under every sprite, in the order they were added
+struct TileMapRenderer : public GameComponent
+{
+public:
+	TileMapRenderer(char *name, char *path, vec2f tileSize, Texture tileset, uint32 tilesetColumns, uint32 tilesetRows);
+
+public:
+	virtual void Init();
+
+	virtual void Destroy();
+
+	//NOTE(kai): marks the tile's chunk dirty, the collision of a TileCollider on the same map doesn't follow
+	void SetTile(uint32 x, uint32 y, uint8 code);
+
+public:
+	char *Path;
+	vec2f TileSize;
+	vec2f Origin;
+
+	Texture Tileset;
+	uint32 TilesetColumns;
+	uint32 TilesetRows;
+
+	TileMap *Map;
+
+	uint32 ChunksX;
+	uint32 ChunksY;
+	std::vector<TileChunk> *Chunks;
+
+	//NOTE(kai): 0 1 3, 1 2 3 for a whole chunk, every chunk shares it
+	QuadIndexBuffer Indices;
+};
+
+//NOTE(kai): rebuilds the dirty chunks that overlap view and adds one for each that has quads to chunks. They draw with
+//			 the sprite vertex format. Returns how many chunks were visible, culled gets how many were skipped
+uint32 CollectTileChunks(TileMapRenderer *renderer, BoundingRect *view, std::vector<SnapshotChunk> *chunks, uint32 *culled);
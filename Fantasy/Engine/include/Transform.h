@@ -56,6 +56,9 @@ mat4f CalcPerspectiveProjection(float fov, float width, float height, float _nea
 
 mat4f CalcProjection(BasicCamera *cam);
 
+//NOTE(kai): the world area an orthographic camera shows, a perspective camera gets an unbounded rect
+BoundingRect CalcViewRect(BasicCamera *cam);
+
 mat4f CalcMVP(Transform *transform, BasicCamera *cam);
 
 bool operator!=(Transform &left, Transform &right); 
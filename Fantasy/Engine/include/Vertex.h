@@ -3,10 +3,12 @@ NOTE(kai): This file contain:
 
 1) Vertex data structure
 2) Color (R, G, B, A) data structure
+3) Compact 2D sprite vertex
 =======================================================================================================================*/
 
 #pragma once
 #include <Cinder\CinderMath.h>
+#include "Types.h"
 
 using namespace Cinder::Math;
 
@@ -20,4 +22,14 @@ struct Vertex
 	vec4f Color;
 	float TextureSlot;
 	vec3f Normal;
+};
+
+//NOTE(kai): 16 bytes against Vertex's 52, sprites are flat so there is no z or normal and the
+//			 uv and color are normalized integers the attribute setup turns back into floats
+struct SpriteVertex
+{
+	float Pos[2];
+	//NOTE(kai): 0..1 stored as 0..65535
+	uint16 TexCoords[2];
+	uint8 Color[4];
 };
\ No newline at end of file
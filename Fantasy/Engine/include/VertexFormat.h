@@ -0,0 +1,54 @@
+#pragma once
+
+#include <GL\glew.h>
+#include "Types.h"
+#include "Vertex.h"
+
+#define VERTEX_FORMAT_MAX_ATTRIBUTES 8
+
+//NOTE(kai): attribute i of a format always goes to location i, the name is what the shader calls it
+struct VertexAttribute
+{
+	char *Name;
+
+	int32 Components;
+	uint32 Type;
+	bool Normalized;
+
+	uint32 Offset;
+};
+
+//NOTE(kai): how one vertex is laid out in a buffer, BindMesh sets the attributes up from it and
+//			 CreateShader binds the shader's attribute names to the same locations
+struct VertexFormat
+{
+	uint32 Stride;
+
+	uint32 AttributeCount;
+	VertexAttribute Attributes[VERTEX_FORMAT_MAX_ATTRIBUTES];
+};
+
+//NOTE(kai): clamped to 0..1 first, for the normalized integer attributes
+inline uint16 ToUnorm16(float value)
+{
+	value = value < 0.0f ? 0.0f : (value > 1.0f ? 1.0f : value);
+
+	return (uint16)(value * 65535.0f + 0.5f);
+}
+
+inline uint8 ToUnorm8(float value)
+{
+	value = value < 0.0f ? 0.0f : (value > 1.0f ? 1.0f : value);
+
+	return (uint8)(value * 255.0f + 0.5f);
+}
+
+//NOTE(kai): Vertex, position, uv, color, texture slot and normal
+VertexFormat* GetMeshVertexFormat();
+
+//NOTE(kai): SpriteVertex, position, uv and color
+VertexFormat* GetSpriteVertexFormat();
+
+//NOTE(kai): points the format's attributes at the bound array buffer starting baseOffset bytes in and
+//			 disables every other location a format could use
+void SetVertexAttributes(VertexFormat *format, uint32 baseOffset);
@@ -0,0 +1,146 @@
+#include <AnimationSystem.h>
+#include <Animator.h>
+
+uint32 AddClipAsset(AnimationSystem *system, char *name, Texture sheet, uint32 maxH, uint32 maxV
+	, std::vector<std::pair<uint32, float>> *frames, bool loop)
+{
+	for (uint32 i = 0; i < system->Clips.size(); i++)
+	{
+		AnimationClipAsset *clip = &system->Clips[i];
+
+		if (clip->Name == name
+			&& clip->Sheet.TextureHandle == sheet.TextureHandle
+			&& clip->Sheet.Region == sheet.Region
+			&& clip->MaxCountHorizontal == maxH
+			&& clip->MaxCountVertical == maxV
+			&& clip->Loop == loop
+			&& clip->Frames == *frames)
+		{
+			return i;
+		}
+	}
+
+	AnimationClipAsset clip = {};
+	clip.MaxCountHorizontal = maxH;
+	clip.MaxCountVertical = maxV;
+	clip.FrameWidth = 1.0f / (float)maxH;
+	clip.FrameHeight = 1.0f / (float)maxV;
+	clip.Sheet = sheet;
+	clip.Frames = *frames;
+	clip.Name = name;
+	clip.Loop = loop;
+
+	system->Clips.push_back(clip);
+
+	return (uint32)system->Clips.size() - 1;
+}
+
+AnimationClipAsset* GetClipAsset(AnimationSystem *system, uint32 id)
+{
+	if (id < system->Clips.size())
+	{
+		return &system->Clips[id];
+	}
+
+	return NULL;
+}
+
+uint32 AddPlayback(AnimationSystem *system, Animator *owner, SpriteRenderer *renderer)
+{
+	AnimationPlayback playback = {};
+	playback.Clip = ANIMATION_NO_CLIP;
+	playback.LastClip = ANIMATION_NO_CLIP;
+	playback.Renderer = renderer;
+	playback.Owner = owner;
+
+	system->Playbacks.push_back(playback);
+
+	return (uint32)system->Playbacks.size() - 1;
+}
+
+void RemovePlayback(AnimationSystem *system, uint32 index)
+{
+	uint32 last = (uint32)system->Playbacks.size() - 1;
+
+	if (index != last)
+	{
+		system->Playbacks[index] = system->Playbacks[last];
+		system->Playbacks[index].Owner->Playback = index;
+	}
+
+	system->Playbacks.pop_back();
+}
+
+void ShowClipFrame(SpriteRenderer *renderer, AnimationClipAsset *clip, uint32 frame)
+{
+	uint32 index = clip->Frames[frame].first;
+
+	uint32 col = index % clip->MaxCountHorizontal;
+	uint32 row = (clip->MaxCountVertical - 1) - (index / clip->MaxCountHorizontal);
+
+	renderer->SpriteData.UVRect = vec4f(float(col) * clip->FrameWidth, float(row) * clip->FrameHeight, clip->FrameWidth, clip->FrameHeight);
+}
+
+void StopPlayback(AnimationPlayback *playback)
+{
+	playback->Time = 0;
+	playback->Frame = 0;
+	playback->Running = false;
+	playback->LastClip = playback->Clip;
+	playback->Clip = ANIMATION_NO_CLIP;
+}
+
+void UpdateAnimations(AnimationSystem *system, float delta)
+{
+	AnimationClipAsset *clips = system->Clips.data();
+
+	for (uint32 i = 0; i < system->Playbacks.size(); i++)
+	{
+		AnimationPlayback *playback = &system->Playbacks[i];
+
+		if (!playback->Updated || playback->Clip == ANIMATION_NO_CLIP)
+		{
+			playback->Updated = false;
+			continue;
+		}
+
+		playback->Updated = false;
+
+		AnimationClipAsset *clip = &clips[playback->Clip];
+		uint32 frameCount = (uint32)clip->Frames.size();
+
+		if (playback->Frame >= frameCount)
+		{
+			if (clip->Loop)
+			{
+				playback->Running = true;
+				playback->Frame = 0;
+			}
+			else
+			{
+				playback->Running = false;
+			}
+		}
+
+		if (playback->Frame < frameCount)
+		{
+			if (playback->Time <= clip->Frames[playback->Frame].second)
+			{
+				ShowClipFrame(playback->Renderer, clip, playback->Frame);
+
+				playback->Time += delta;
+			}
+			else
+			{
+				playback->Frame++;
+				playback->Time = 0;
+			}
+		}
+
+		if (playback->StopWhenDone && playback->Frame >= frameCount)
+		{
+			StopPlayback(playback);
+			playback->StopWhenDone = false;
+		}
+	}
+}
@@ -12,10 +12,7 @@ AnimationClip::AnimationClip()
 
 	Sheet = {};
 
-	CurrentFrame = 0;
-
 	FrameTime = 0;
-	Counter = 0;
 
 	Frames = std::vector<std::pair<uint32, float>>();
 }
@@ -32,14 +29,9 @@ AnimationClip::AnimationClip(Texture texture
 	FrameHeight = 1.0f / (float)maxV;
 
 	Loop = loop;
-	IsRunning = false;
 
 	Sheet = texture;
 
-	CurrentFrame = 0;
-
-	Counter = 0;
-
 	FrameTime = frameTime < (1.0f / 60.0f) ? (1.0f / 60.0f) : frameTime;
 	for (uint32 i = 0; i < maxH * maxV; i++)
 	{
@@ -59,12 +51,9 @@ AnimationClip::AnimationClip(Texture texture
 	FrameHeight = 1.0f / (float)maxV;
 
 	Loop = loop;
-	IsRunning = false;
 	Sheet = texture;
 
 	FrameTime = 0;
-	CurrentFrame = 0;
-	Counter = 0;
 
 	for (uint32 i = 0; i < frames->size(); i++)
 	{
@@ -79,214 +68,138 @@ Animator::Animator(char *name, SpriteRenderer *renderer)
 
 	Renderer = renderer;
 	Name = name;
-	LastRunningClip = NULL;
-	CurrentClip = NULL;
-	StopFlag = false;
 
-	Clips = new std::map<char *, AnimationClip *>();
+	Playback = ANIMATION_NO_CLIP;
+	SlotCount = 0;
 }
 
 void Animator::Destroy()
 {
-	std::map<char *, AnimationClip*>::iterator it;
-
-	for (it = (*Clips).begin(); it != (*Clips).end(); it++)
+	if (Playback != ANIMATION_NO_CLIP)
 	{
-		delete it->second;
+		RemovePlayback(&Scene->Animations, Playback);
+		Playback = ANIMATION_NO_CLIP;
 	}
 
-	(*Clips).clear();
-	delete Clips;
+	SlotCount = 0;
 }
 
 void Animator::Update(float delta, Game_Input *input)
 {
-	if (CurrentClip)
+	GetPlayback()->Updated = true;
+}
+
+AnimationPlayback* Animator::GetPlayback()
+{
+	//NOTE(kai): the scene isn't known in the constructor, the playback is made the first time it's needed
+	if (Playback == ANIMATION_NO_CLIP)
 	{
-		if (CurrentClip->Loop && CurrentClip->CurrentFrame >= CurrentClip->Frames.size())
-		{
-			CurrentClip->IsRunning = true;
-			CurrentClip->CurrentFrame = 0;
-			CurrentClip->Counter;
-		}
-		else if (!CurrentClip->Loop && CurrentClip->CurrentFrame >= CurrentClip->Frames.size())
-		{
-			CurrentClip->IsRunning = false;
-		}
+		Playback = AddPlayback(&Scene->Animations, this, Renderer);
+	}
+
+	return &Scene->Animations.Playbacks[Playback];
+}
 
-		if (CurrentClip->CurrentFrame < CurrentClip->Frames.size())
+uint32 Animator::FindClip(char *name)
+{
+	for (uint32 i = 0; i < SlotCount; i++)
+	{
+		if (Slots[i].Name == name)
 		{
-			if (CurrentClip->Counter <= CurrentClip->Frames[CurrentClip->CurrentFrame].second)
-			{
-				uint32 col = CurrentClip->Frames[CurrentClip->CurrentFrame].first % CurrentClip->MaxCountHorizontal;
-				uint32 row = (CurrentClip->MaxCountVertical - 1) - (CurrentClip->Frames[CurrentClip->CurrentFrame].first / CurrentClip->MaxCountHorizontal);
-
-				vec2f bottomLeft = vec2f(float(col) * CurrentClip->FrameWidth, float(row) * CurrentClip->FrameHeight);
-				vec2f bottomRight = vec2f((float(col) * CurrentClip->FrameWidth) + CurrentClip->FrameWidth, float(row) * CurrentClip->FrameHeight);
-				vec2f topLeft = vec2f(float(col) * CurrentClip->FrameWidth, (float(row) * CurrentClip->FrameHeight) + CurrentClip->FrameHeight);
-				vec2f topRight = vec2f((float(col) * CurrentClip->FrameWidth) + CurrentClip->FrameWidth, (float(row) * CurrentClip->FrameHeight) + CurrentClip->FrameHeight);
-
-				BindMesh(&Renderer->SpriteData.Buffers);
-
-				Vertex *vertices = (Vertex *)glMapBuffer(GL_ARRAY_BUFFER, GL_WRITE_ONLY);
-				vertices[0].TexCoords = bottomLeft;
-				vertices[1].TexCoords = topLeft;
-				vertices[2].TexCoords = topRight;
-				vertices[3].TexCoords = bottomRight;
-
-				glUnmapBuffer(GL_ARRAY_BUFFER);
-				UnbindMesh();
-
-				CurrentClip->Counter += Scene->Delta;
-			}
-			else
-			{
-				CurrentClip->CurrentFrame++;
-				CurrentClip->Counter = 0;
-			}
+			return Slots[i].Clip;
 		}
 	}
 
-	if (StopFlag)
+	return ANIMATION_NO_CLIP;
+}
+
+char* Animator::FindClipName(uint32 clip)
+{
+	for (uint32 i = 0; i < SlotCount; i++)
 	{
-		if (IsFinished())
+		if (Slots[i].Clip == clip)
 		{
-			StopClip();
-			StopFlag = false;
+			return Slots[i].Name;
 		}
 	}
+
+	return "";
 }
 
-void Animator::SetStartClip(char *name)
+void Animator::ShowClip(uint32 clip)
 {
-	AnimationClip *clip = GetClip(name);
+	AnimationClipAsset *asset = GetClipAsset(&Scene->Animations, clip);
 
-	if (clip)
-	{
-		CurrentClip = clip;
-		Renderer->SpriteData.Skin.MeshTexture = (*Clips)[name]->Sheet;
-
-		uint32 col = CurrentClip->Frames[CurrentClip->CurrentFrame].first % CurrentClip->MaxCountHorizontal;
-		uint32 row = (CurrentClip->MaxCountVertical - 1) - (CurrentClip->Frames[CurrentClip->CurrentFrame].first / CurrentClip->MaxCountHorizontal);
-
-		vec2f bottomLeft = vec2f(float(col) * CurrentClip->FrameWidth, float(row) * CurrentClip->FrameHeight);
-		vec2f bottomRight = vec2f((float(col) * CurrentClip->FrameWidth) + CurrentClip->FrameWidth, float(row) * CurrentClip->FrameHeight);
-		vec2f topLeft = vec2f(float(col) * CurrentClip->FrameWidth, (float(row) * CurrentClip->FrameHeight) + CurrentClip->FrameHeight);
-		vec2f topRight = vec2f((float(col) * CurrentClip->FrameWidth) + CurrentClip->FrameWidth, (float(row) * CurrentClip->FrameHeight) + CurrentClip->FrameHeight);
+	Renderer->SpriteData.Skin.MeshTexture = asset->Sheet;
+	ShowClipFrame(Renderer, asset, GetPlayback()->Frame);
+}
 
-		BindMesh(&Renderer->SpriteData.Buffers);
+void Animator::SetStartClip(char *name)
+{
+	uint32 clip = FindClip(name);
 
-		Vertex *vertices = (Vertex *)glMapBuffer(GL_ARRAY_BUFFER, GL_WRITE_ONLY);
-		vertices[0].TexCoords = bottomLeft;
-		vertices[1].TexCoords = topLeft;
-		vertices[2].TexCoords = topRight;
-		vertices[3].TexCoords = bottomRight;
+	if (clip != ANIMATION_NO_CLIP)
+	{
+		AnimationPlayback *playback = GetPlayback();
 
-		glUnmapBuffer(GL_ARRAY_BUFFER);
-		UnbindMesh();
+		playback->Clip = clip;
+		playback->LastClip = ANIMATION_NO_CLIP;
+		playback->Frame = 0;
+		playback->Time = 0;
 
-		LastRunningClip = NULL;
+		ShowClip(clip);
 	}
 }
 
 void Animator::SwitchClip(char *name)
 {
-	AnimationClip *clip = GetClip(name);
+	uint32 clip = FindClip(name);
+	AnimationPlayback *playback = GetPlayback();
 
-	if (clip)
+	if (clip != ANIMATION_NO_CLIP && clip != playback->Clip)
 	{
-		if (clip != CurrentClip)
-		{
-			StopFlag = false;
-
-			if (CurrentClip)
-			{
-				StopClip();
-			}
-
-			LastRunningClip = CurrentClip;
-			CurrentClip = clip;
-			StopClip();
-			ResumeClip();
-			Renderer->SpriteData.Skin.MeshTexture = clip->Sheet;
-
-			uint32 col = CurrentClip->Frames[CurrentClip->CurrentFrame].first % CurrentClip->MaxCountHorizontal;
-			uint32 row = (CurrentClip->MaxCountVertical - 1) - (CurrentClip->Frames[CurrentClip->CurrentFrame].first / CurrentClip->MaxCountHorizontal);
-
-			vec2f bottomLeft = vec2f(float(col) * CurrentClip->FrameWidth, float(row) * CurrentClip->FrameHeight);
-			vec2f bottomRight = vec2f((float(col) * CurrentClip->FrameWidth) + CurrentClip->FrameWidth, float(row) * CurrentClip->FrameHeight);
-			vec2f topLeft = vec2f(float(col) * CurrentClip->FrameWidth, (float(row) * CurrentClip->FrameHeight) + CurrentClip->FrameHeight);
-			vec2f topRight = vec2f((float(col) * CurrentClip->FrameWidth) + CurrentClip->FrameWidth, (float(row) * CurrentClip->FrameHeight) + CurrentClip->FrameHeight);
-
-			BindMesh(&Renderer->SpriteData.Buffers);
+		StopPlayback(playback);
 
-			Vertex *vertices = (Vertex *)glMapBuffer(GL_ARRAY_BUFFER, GL_WRITE_ONLY);
-			vertices[0].TexCoords = bottomLeft;
-			vertices[1].TexCoords = topLeft;
-			vertices[2].TexCoords = topRight;
-			vertices[3].TexCoords = bottomRight;
+		playback->Clip = clip;
+		playback->LastClip = ANIMATION_NO_CLIP;
+		playback->Running = true;
+		playback->StopWhenDone = false;
 
-			glUnmapBuffer(GL_ARRAY_BUFFER);
-			UnbindMesh();
-		}
+		ShowClip(clip);
 	}
 }
 
 void Animator::AddClip(char *name, AnimationClip *clip)
 {
-	if ((*Clips).find(name) == (*Clips).end())
+	if (FindClip(name) != ANIMATION_NO_CLIP || SlotCount >= ANIMATOR_MAX_CLIPS)
 	{
-		AnimationClip *c = new AnimationClip();
-		c->Counter = clip->Counter;
-		c->CurrentFrame = clip->CurrentFrame;
-		c->MaxCountHorizontal = clip->MaxCountHorizontal;
-		c->MaxCountVertical = clip->MaxCountVertical;
-		c->FrameHeight = clip->FrameHeight;
-		c->FrameWidth = clip->FrameWidth;
-		c->FrameTime = clip->FrameTime;
-		c->Loop = clip->Loop;
-		c->Sheet = clip->Sheet;
-		c->Name = name;
-
-		for (uint32 i = 0; i < clip->Frames.size(); i++)
-		{
-			c->Frames.push_back(clip->Frames[i]);
-		}
-
-		(*Clips)[name] = c;
-
-		if (!CurrentClip)
-		{
-			CurrentClip = (*Clips)[name];
-			Renderer->SpriteData.Skin.MeshTexture = (*Clips)[name]->Sheet;
+		return;
+	}
 
-			uint32 col = CurrentClip->Frames[CurrentClip->CurrentFrame].first % CurrentClip->MaxCountHorizontal;
-			uint32 row = (CurrentClip->MaxCountVertical - 1) - (CurrentClip->Frames[CurrentClip->CurrentFrame].first / CurrentClip->MaxCountHorizontal);
+	uint32 id = AddClipAsset(&Scene->Animations, name, clip->Sheet
+		, clip->MaxCountHorizontal, clip->MaxCountVertical, &clip->Frames, clip->Loop);
 
-			vec2f bottomLeft = vec2f(float(col) * CurrentClip->FrameWidth, float(row) * CurrentClip->FrameHeight);
-			vec2f bottomRight = vec2f((float(col) * CurrentClip->FrameWidth) + CurrentClip->FrameWidth, float(row) * CurrentClip->FrameHeight);
-			vec2f topLeft = vec2f(float(col) * CurrentClip->FrameWidth, (float(row) * CurrentClip->FrameHeight) + CurrentClip->FrameHeight);
-			vec2f topRight = vec2f((float(col) * CurrentClip->FrameWidth) + CurrentClip->FrameWidth, (float(row) * CurrentClip->FrameHeight) + CurrentClip->FrameHeight);
+	Slots[SlotCount++] = AnimatorClipSlot{ name, id };
 
-			BindMesh(&Renderer->SpriteData.Buffers);
+	AnimationPlayback *playback = GetPlayback();
 
-			Vertex *vertices = (Vertex *)glMapBuffer(GL_ARRAY_BUFFER, GL_WRITE_ONLY);
-			vertices[0].TexCoords = bottomLeft;
-			vertices[1].TexCoords = topLeft;
-			vertices[2].TexCoords = topRight;
-			vertices[3].TexCoords = bottomRight;
+	if (playback->Clip == ANIMATION_NO_CLIP)
+	{
+		playback->Clip = id;
+		playback->Frame = 0;
+		playback->Time = 0;
 
-			glUnmapBuffer(GL_ARRAY_BUFFER);
-			UnbindMesh();
-		}
+		ShowClip(id);
 	}
 }
 
-AnimationClip* Animator::GetClip(char *name)
+AnimationClipAsset* Animator::GetClip(char *name)
 {
-	if (Clips->find(name) != Clips->end())
+	uint32 clip = FindClip(name);
+
+	if (clip != ANIMATION_NO_CLIP)
 	{
-		return (*Clips)[name];
+		return GetClipAsset(&Scene->Animations, clip);
 	}
 
 	return NULL;
@@ -294,81 +207,58 @@ AnimationClip* Animator::GetClip(char *name)
 
 void Animator::PauseClip()
 {
-	CurrentClip->IsRunning = false;
-	LastRunningClip = CurrentClip;
-	CurrentClip = NULL;
+	AnimationPlayback *playback = GetPlayback();
+
+	if (playback->Clip != ANIMATION_NO_CLIP)
+	{
+		playback->Running = false;
+		playback->LastClip = playback->Clip;
+		playback->Clip = ANIMATION_NO_CLIP;
+	}
 }
 
 void Animator::ResumeClip()
 {
-	CurrentClip = LastRunningClip;
-	LastRunningClip = NULL;
-	CurrentClip->IsRunning = true;
-	StopFlag = false;
+	AnimationPlayback *playback = GetPlayback();
+
+	if (playback->LastClip != ANIMATION_NO_CLIP)
+	{
+		playback->Clip = playback->LastClip;
+		playback->LastClip = ANIMATION_NO_CLIP;
+		playback->Running = true;
+		playback->StopWhenDone = false;
+	}
 }
 
 void Animator::StopClip()
 {
-	CurrentClip->Counter = 0;
-	CurrentClip->CurrentFrame = 0;
-	CurrentClip->IsRunning = false;
-	LastRunningClip = CurrentClip;
-	CurrentClip = NULL;
-}
+	AnimationPlayback *playback = GetPlayback();
 
-bool Animator::IsFinished()
-{
-	if (CurrentClip)
+	if (playback->Clip != ANIMATION_NO_CLIP)
 	{
-		if (CurrentClip->CurrentFrame >= CurrentClip->Frames.size())
-		{
-			return true;
-		}
+		StopPlayback(playback);
 	}
-
-	return false;
 }
 
 void Animator::StopWhenDone()
 {
-	StopFlag = true;
+	GetPlayback()->StopWhenDone = true;
 }
 
 char* Animator::GetCurrentClipName()
 {
-	if (CurrentClip)
-	{
-		return CurrentClip->Name;
-	}
-
-	return "";
+	return FindClipName(GetPlayback()->Clip);
 }
 
 char* Animator::GetLastClipName()
 {
-	if (LastRunningClip)
-	{
-		return LastRunningClip->Name;
-	}
-
-	return "";
+	return FindClipName(GetPlayback()->LastClip);
 }
 
 bool Animator::IsRunning(char *name)
 {
-	AnimationClip *clip = GetClip(name);
-	
-	if (clip)
-	{
-		if (clip->IsRunning)
-		{
-			return true;
-		}
-		else
-		{
-			return false;
-		}
-	}
+	uint32 clip = FindClip(name);
+	AnimationPlayback *playback = GetPlayback();
 
-	return false;
+	return clip != ANIMATION_NO_CLIP && clip == playback->Clip && playback->Running;
 }
\ No newline at end of file
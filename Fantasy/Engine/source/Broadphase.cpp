@@ -0,0 +1,177 @@
+#include <Broadphase.h>
+#include <algorithm>
+
+void Broadphase::Clear()
+{
+	Proxies.clear();
+}
+
+uint32 Broadphase::AddProxy(BroadphaseProxy proxy)
+{
+	Proxies.push_back(proxy);
+
+	return (uint32)Proxies.size() - 1;
+}
+
+void Broadphase::Sort()
+{
+	uint32 count = (uint32)Proxies.size();
+	BroadphaseProxy *proxies = Proxies.data();
+
+	if (Order.size() != count)
+	{
+		//NOTE(kai): the collider set changed so the old order is useless
+		Order.resize(count);
+
+		for (uint32 i = 0; i < count; i++)
+		{
+			Order[i] = i;
+		}
+
+		std::sort(Order.begin(), Order.end(), [proxies](uint32 a, uint32 b)
+		{
+			return proxies[a].MinX < proxies[b].MinX;
+		});
+
+		return;
+	}
+
+	for (uint32 i = 1; i < count; i++)
+	{
+		uint32 index = Order[i];
+		float minX = proxies[index].MinX;
+		int32 j = (int32)i - 1;
+
+		while (j >= 0 && proxies[Order[j]].MinX > minX)
+		{
+			Order[j + 1] = Order[j];
+			j--;
+		}
+
+		Order[j + 1] = index;
+	}
+}
+
+void Broadphase::FindPairs(std::vector<BroadphasePair> *pairs)
+{
+	pairs->clear();
+
+	Sort();
+
+	uint32 count = (uint32)Order.size();
+
+	for (uint32 i = 0; i < count; i++)
+	{
+		BroadphaseProxy *a = &Proxies[Order[i]];
+
+		for (uint32 j = i + 1; j < count; j++)
+		{
+			BroadphaseProxy *b = &Proxies[Order[j]];
+
+			if (b->MinX > a->MaxX)
+			{
+				break;
+			}
+
+			if (b->MinY > a->MaxY || b->MaxY < a->MinY)
+			{
+				continue;
+			}
+
+			if (a->Resting && b->Resting)
+			{
+				continue;
+			}
+
+			if (!CanCollide(a, b))
+			{
+				continue;
+			}
+
+			//NOTE(kai): keep the lower index first, the narrowphase tests both orders anyway
+			if (Order[i] < Order[j])
+			{
+				pairs->push_back(BroadphasePair{ Order[i], Order[j] });
+			}
+			else
+			{
+				pairs->push_back(BroadphasePair{ Order[j], Order[i] });
+			}
+		}
+	}
+}
+
+void Broadphase::PrepareQueries()
+{
+	Sort();
+
+	MaxWidth = 0.0f;
+	WideProxies.clear();
+
+	for (uint32 i = 0; i < Proxies.size(); i++)
+	{
+		float width = Proxies[i].MaxX - Proxies[i].MinX;
+
+		if (width > BROADPHASE_WIDE_PROXY)
+		{
+			WideProxies.push_back(i);
+		}
+		else if (width > MaxWidth)
+		{
+			MaxWidth = width;
+		}
+	}
+}
+
+void Broadphase::Query(float minX, float minY, float maxX, float maxY, uint32 layerMask, std::vector<uint32> *result)
+{
+	BroadphaseProxy *proxies = Proxies.data();
+
+	//NOTE(kai): nothing that starts further left than the widest proxy can reach the box
+	float startX = minX - MaxWidth;
+
+	std::vector<uint32>::iterator first = std::lower_bound(Order.begin(), Order.end(), startX,
+		[proxies](uint32 index, float x)
+	{
+		return proxies[index].MinX < x;
+	});
+
+	for (; first != Order.end(); first++)
+	{
+		BroadphaseProxy *proxy = &proxies[*first];
+
+		if (proxy->MinX > maxX)
+		{
+			break;
+		}
+
+		if (proxy->MaxX < minX || proxy->MinY > maxY || proxy->MaxY < minY)
+		{
+			continue;
+		}
+
+		if (proxy->MaxX - proxy->MinX > BROADPHASE_WIDE_PROXY || !(proxy->LayerBits & layerMask) || !proxy->Owner)
+		{
+			continue;
+		}
+
+		result->push_back(*first);
+	}
+
+	for (uint32 i = 0; i < WideProxies.size(); i++)
+	{
+		BroadphaseProxy *proxy = &proxies[WideProxies[i]];
+
+		if (proxy->MaxX < minX || proxy->MinX > maxX || proxy->MinY > maxY || proxy->MaxY < minY)
+		{
+			continue;
+		}
+
+		if (!(proxy->LayerBits & layerMask) || !proxy->Owner)
+		{
+			continue;
+		}
+
+		result->push_back(WideProxies[i]);
+	}
+}
@@ -1,6 +1,17 @@
 #include <Collider.h>
 #include <SceneManager.h>
 
+void Collider::Init()
+{
+	OldPos = &Owner->ObjectTransform.OldPos;
+	hasPathStart = false;
+
+	if (Owner->Layer && *Owner->Layer)
+	{
+		layerBits = Scene->PEngine.AddLayer(Owner->Layer);
+	}
+}
+
 std::vector <char*> Collider::checkObjectCollision()
 {
 	std::vector<char*> collidedActors;
@@ -21,43 +32,57 @@ std::vector <char*> Collider::checkObjectCollision()
 	return collidedActors;
 }
 
+void Collider::Teleport(vec3f position)
+{
+	*pos = position;
+	hasPathStart = false;
+
+	Scene->PEngine.WakeCollider(this);
+}
+
 bool Collider::CheckGroundCollision()
 {
-	std::vector<GameComponent *> *colliders = Scene->GetAllComponents("COLLIDER");
-	
-	if (colliders)
+	down = false;
+	jump = false;
+
+	//NOTE(kai): the query index has the colliders where the last update left them, tile maps aren't in it
+	//			 so the grid is asked for the rects around us too
+	float x = pos->X + offset.X;
+	float y = pos->Y + offset.Y;
+	vec2f half = vec2f(size.X / 2.0f + 1.0f, size.Y / 2.0f + 1.0f);
+
+	std::vector<Collider *> *candidates = &Scene->PEngine.GroundCandidates;
+	candidates->clear();
+
+	Scene->PEngine.OverlapBox(vec2f(x, y), half, candidates);
+	Scene->PEngine.FindTileColliders(x - half.X, y - half.Y, x + half.X, y + half.Y, candidates);
+
+	for (uint32 i = 0; i < candidates->size(); i++)
 	{
-		down = false;
-		jump = false;
+		Collider *collider = (*candidates)[i];
 
-		for (uint32 i = 0; i < colliders->size(); i++)
+		if (collider != this && collider->ground)
 		{
-			Collider *collider = (Collider*)(*colliders)[i];
-			if (collider != this)
+			if (Scene->PEngine.AABBvsAABB(this, collider))
 			{
-				if (collider->ground)
+				//check down collision
+				if (down == true)
 				{
-					if (Scene->PEngine.AABBvsAABB(this, collider))
-					{
-						//check down collision
-						if (down == true)
-						{
-							jump = true;
-
-							return true;
-						}
-					}
+					jump = true;
+
+					return true;
 				}
 			}
 		}
-	}	
+	}
 
 	return false;
 }
 
 void Collider::Update(float delta, Game_Input *input)
 {
-	if (!ground)
+	//NOTE(kai): a sleeping collider keeps the ground flags it went to sleep with
+	if (!ground && !sleeping)
 	{
 		CheckGroundCollision();
 	}
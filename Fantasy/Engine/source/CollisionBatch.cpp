@@ -0,0 +1,290 @@
+#include <CollisionBatch.h>
+#include <math.h>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+
+#define COLLISION_LANES 8
+typedef __m256 lane;
+
+#define LaneLoad(p) _mm256_loadu_ps(p)
+#define LaneStore(p, a) _mm256_storeu_ps(p, a)
+#define LaneSet(a) _mm256_set1_ps(a)
+#define LaneAdd(a, b) _mm256_add_ps(a, b)
+#define LaneSub(a, b) _mm256_sub_ps(a, b)
+#define LaneDiv(a, b) _mm256_div_ps(a, b)
+#define LaneMin(a, b) _mm256_min_ps(a, b)
+#define LaneMax(a, b) _mm256_max_ps(a, b)
+#define LaneAnd(a, b) _mm256_and_ps(a, b)
+#define LaneAndNot(a, b) _mm256_andnot_ps(a, b)
+#define LaneOr(a, b) _mm256_or_ps(a, b)
+#define LaneLessEqual(a, b) _mm256_cmp_ps(a, b, _CMP_LE_OQ)
+#define LaneEqual(a, b) _mm256_cmp_ps(a, b, _CMP_EQ_OQ)
+#define LaneMask(a) _mm256_movemask_ps(a)
+
+#elif defined(_M_IX86) || defined(_M_X64) || defined(__SSE2__)
+#include <emmintrin.h>
+
+#define COLLISION_LANES 4
+typedef __m128 lane;
+
+#define LaneLoad(p) _mm_loadu_ps(p)
+#define LaneStore(p, a) _mm_storeu_ps(p, a)
+#define LaneSet(a) _mm_set1_ps(a)
+#define LaneAdd(a, b) _mm_add_ps(a, b)
+#define LaneSub(a, b) _mm_sub_ps(a, b)
+#define LaneDiv(a, b) _mm_div_ps(a, b)
+#define LaneMin(a, b) _mm_min_ps(a, b)
+#define LaneMax(a, b) _mm_max_ps(a, b)
+#define LaneAnd(a, b) _mm_and_ps(a, b)
+#define LaneAndNot(a, b) _mm_andnot_ps(a, b)
+#define LaneOr(a, b) _mm_or_ps(a, b)
+#define LaneLessEqual(a, b) _mm_cmple_ps(a, b)
+#define LaneEqual(a, b) _mm_cmpeq_ps(a, b)
+#define LaneMask(a) _mm_movemask_ps(a)
+
+#endif
+
+//NOTE(kai): a zero velocity becomes a tiny one so its slab is either everything or nothing
+#define SLAB_EPSILON 1e-20f
+
+void ColliderSoA::Clear()
+{
+	CenterX.clear();
+	CenterY.clear();
+	HalfX.clear();
+	HalfY.clear();
+	VelocityX.clear();
+	VelocityY.clear();
+}
+
+uint32 ColliderSoA::Add(float centerX, float centerY, float halfX, float halfY, float velocityX, float velocityY)
+{
+	CenterX.push_back(centerX);
+	CenterY.push_back(centerY);
+	HalfX.push_back(halfX);
+	HalfY.push_back(halfY);
+	VelocityX.push_back(velocityX);
+	VelocityY.push_back(velocityY);
+
+	return (uint32)CenterX.size() - 1;
+}
+
+void GatherBatch(CollisionBatch *batch, ColliderSoA *bodies, uint32 *indices, uint32 count)
+{
+	if (count > COLLISION_BATCH_SIZE)
+	{
+		count = COLLISION_BATCH_SIZE;
+	}
+
+	for (uint32 i = 0; i < count; i++)
+	{
+		uint32 index = indices[i];
+
+		batch->CenterX[i] = bodies->CenterX[index];
+		batch->CenterY[i] = bodies->CenterY[index];
+		batch->HalfX[i] = bodies->HalfX[index];
+		batch->HalfY[i] = bodies->HalfY[index];
+		batch->VelocityX[i] = bodies->VelocityX[index];
+		batch->VelocityY[i] = bodies->VelocityY[index];
+	}
+
+	batch->Count = count;
+}
+
+uint32 OverlapAABBBatch(float centerX, float centerY, float halfX, float halfY, CollisionBatch *batch)
+{
+	uint32 mask = 0;
+	uint32 i = 0;
+
+#ifdef COLLISION_LANES
+	lane signBit = LaneSet(-0.0f);
+	lane ax = LaneSet(centerX);
+	lane ay = LaneSet(centerY);
+	lane ahx = LaneSet(halfX);
+	lane ahy = LaneSet(halfY);
+
+	for (; i + COLLISION_LANES <= batch->Count; i += COLLISION_LANES)
+	{
+		lane dx = LaneAndNot(signBit, LaneSub(LaneLoad(batch->CenterX + i), ax));
+		lane dy = LaneAndNot(signBit, LaneSub(LaneLoad(batch->CenterY + i), ay));
+		lane rx = LaneAdd(LaneLoad(batch->HalfX + i), ahx);
+		lane ry = LaneAdd(LaneLoad(batch->HalfY + i), ahy);
+
+		lane hit = LaneAnd(LaneLessEqual(dx, rx), LaneLessEqual(dy, ry));
+
+		mask |= (uint32)LaneMask(hit) << i;
+	}
+#endif
+
+	for (; i < batch->Count; i++)
+	{
+		float dx = fabsf(batch->CenterX[i] - centerX);
+		float dy = fabsf(batch->CenterY[i] - centerY);
+
+		if (dx <= batch->HalfX[i] + halfX && dy <= batch->HalfY[i] + halfY)
+		{
+			mask |= 1u << i;
+		}
+	}
+
+	return mask;
+}
+
+uint32 SweptAABBBatch(float centerX, float centerY, float halfX, float halfY, float velocityX, float velocityY,
+					  CollisionBatch *batch)
+{
+	uint32 mask = 0;
+	uint32 i = 0;
+
+#ifdef COLLISION_LANES
+	lane signBit = LaneSet(-0.0f);
+	lane zero = LaneSet(0.0f);
+	lane one = LaneSet(1.0f);
+	lane epsilon = LaneSet(SLAB_EPSILON);
+	lane noImpact = LaneSet(COLLISION_NO_IMPACT);
+
+	lane ax = LaneSet(centerX);
+	lane ay = LaneSet(centerY);
+	lane ahx = LaneSet(halfX);
+	lane ahy = LaneSet(halfY);
+	lane avx = LaneSet(velocityX);
+	lane avy = LaneSet(velocityY);
+
+	for (; i + COLLISION_LANES <= batch->Count; i += COLLISION_LANES)
+	{
+		lane dx = LaneSub(LaneLoad(batch->CenterX + i), ax);
+		lane dy = LaneSub(LaneLoad(batch->CenterY + i), ay);
+		lane rx = LaneAdd(LaneLoad(batch->HalfX + i), ahx);
+		lane ry = LaneAdd(LaneLoad(batch->HalfY + i), ahy);
+		lane vx = LaneSub(avx, LaneLoad(batch->VelocityX + i));
+		lane vy = LaneSub(avy, LaneLoad(batch->VelocityY + i));
+
+		// swept bounds, the gap on each axis has to be covered by the relative velocity
+		lane hitX = LaneLessEqual(LaneAndNot(signBit, dx), LaneAdd(rx, LaneAndNot(signBit, vx)));
+		lane hitY = LaneLessEqual(LaneAndNot(signBit, dy), LaneAdd(ry, LaneAndNot(signBit, vy)));
+		lane hit = LaneAnd(hitX, hitY);
+
+		// slab method for the time of impact
+		lane zeroX = LaneEqual(vx, zero);
+		lane zeroY = LaneEqual(vy, zero);
+		vx = LaneOr(LaneAnd(zeroX, epsilon), LaneAndNot(zeroX, vx));
+		vy = LaneOr(LaneAnd(zeroY, epsilon), LaneAndNot(zeroY, vy));
+
+		lane tx1 = LaneDiv(LaneSub(dx, rx), vx);
+		lane tx2 = LaneDiv(LaneAdd(dx, rx), vx);
+		lane ty1 = LaneDiv(LaneSub(dy, ry), vy);
+		lane ty2 = LaneDiv(LaneAdd(dy, ry), vy);
+
+		lane enter = LaneMax(LaneMin(tx1, tx2), LaneMin(ty1, ty2));
+		lane exit = LaneMin(LaneMax(tx1, tx2), LaneMax(ty1, ty2));
+
+		lane impact = LaneAnd(LaneAnd(LaneLessEqual(enter, exit), LaneLessEqual(zero, exit)), LaneLessEqual(enter, one));
+		lane toi = LaneMax(enter, zero);
+		toi = LaneOr(LaneAnd(impact, toi), LaneAndNot(impact, noImpact));
+
+		LaneStore(batch->TimeOfImpact + i, toi);
+
+		mask |= (uint32)LaneMask(hit) << i;
+	}
+#endif
+
+	for (; i < batch->Count; i++)
+	{
+		float dx = batch->CenterX[i] - centerX;
+		float dy = batch->CenterY[i] - centerY;
+		float rx = batch->HalfX[i] + halfX;
+		float ry = batch->HalfY[i] + halfY;
+		float vx = velocityX - batch->VelocityX[i];
+		float vy = velocityY - batch->VelocityY[i];
+
+		if (fabsf(dx) <= rx + fabsf(vx) && fabsf(dy) <= ry + fabsf(vy))
+		{
+			mask |= 1u << i;
+		}
+
+		if (vx == 0.0f)
+		{
+			vx = SLAB_EPSILON;
+		}
+
+		if (vy == 0.0f)
+		{
+			vy = SLAB_EPSILON;
+		}
+
+		float tx1 = (dx - rx) / vx;
+		float tx2 = (dx + rx) / vx;
+		float ty1 = (dy - ry) / vy;
+		float ty2 = (dy + ry) / vy;
+
+		float enter = fmaxf(fminf(tx1, tx2), fminf(ty1, ty2));
+		float exit = fminf(fmaxf(tx1, tx2), fmaxf(ty1, ty2));
+
+		if (enter <= exit && exit >= 0.0f && enter <= 1.0f)
+		{
+			batch->TimeOfImpact[i] = fmaxf(enter, 0.0f);
+		}
+		else
+		{
+			batch->TimeOfImpact[i] = COLLISION_NO_IMPACT;
+		}
+	}
+
+	return mask;
+}
+
+bool SweptAABBTimeOfImpact(float centerX, float centerY, float halfX, float halfY, float motionX, float motionY,
+						   float otherX, float otherY, float otherHalfX, float otherHalfY,
+						   float *toi, float *normalX, float *normalY)
+{
+	float dx = otherX - centerX;
+	float dy = otherY - centerY;
+	float rx = otherHalfX + halfX;
+	float ry = otherHalfY + halfY;
+
+	float vx = motionX == 0.0f ? SLAB_EPSILON : motionX;
+	float vy = motionY == 0.0f ? SLAB_EPSILON : motionY;
+
+	float tx1 = (dx - rx) / vx;
+	float tx2 = (dx + rx) / vx;
+	float ty1 = (dy - ry) / vy;
+	float ty2 = (dy + ry) / vy;
+
+	float enterX = fminf(tx1, tx2);
+	float enterY = fminf(ty1, ty2);
+	float enter = fmaxf(enterX, enterY);
+	float exit = fminf(fmaxf(tx1, tx2), fmaxf(ty1, ty2));
+
+	//NOTE(kai): boxes that already overlap have no entry time, SweepContinuous pushes A out of those before sweeping
+	if (enter > exit || enter < 0.0f || enter > 1.0f)
+	{
+		return false;
+	}
+
+	if (enterX > enterY)
+	{
+		//NOTE(kai): sliding along a face isn't moving into it
+		if (motionX == 0.0f)
+		{
+			return false;
+		}
+
+		*normalX = motionX > 0.0f ? -1.0f : 1.0f;
+		*normalY = 0.0f;
+	}
+	else
+	{
+		if (motionY == 0.0f)
+		{
+			return false;
+		}
+
+		*normalX = 0.0f;
+		*normalY = motionY > 0.0f ? -1.0f : 1.0f;
+	}
+
+	*toi = enter;
+
+	return true;
+}
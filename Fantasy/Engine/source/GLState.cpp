@@ -0,0 +1,315 @@
+#include <GLState.h>
+#include <vector>
+#include <mutex>
+
+file_internal thread_local GLStateCache State =
+{
+	GL_STATE_UNKNOWN,
+	GL_STATE_UNKNOWN,
+	GL_STATE_UNKNOWN,
+	GL_STATE_UNKNOWN,
+	GL_STATE_UNKNOWN,
+	{ GL_STATE_UNKNOWN, GL_STATE_UNKNOWN, GL_STATE_UNKNOWN, GL_STATE_UNKNOWN, GL_STATE_UNKNOWN, GL_STATE_UNKNOWN, GL_STATE_UNKNOWN, GL_STATE_UNKNOWN },
+	0,
+	0,
+};
+
+//NOTE(kai): shared by every thread, only touched under DeferredLock
+file_internal std::mutex DeferredLock;
+file_internal std::vector<GLDeferredDelete> DeferredDeletes;
+file_internal std::thread::id RenderThread;
+file_internal bool DeferDeletes = false;
+file_internal uint32 DeferredFrame = 0;
+
+//NOTE(kai): true when the delete was queued, the caller still forgets the handle in its own cache
+file_internal bool DeferDelete(uint32 type, uint32 handle)
+{
+	std::lock_guard<std::mutex> lock(DeferredLock);
+
+	if (!DeferDeletes || std::this_thread::get_id() == RenderThread)
+	{
+		return false;
+	}
+
+	DeferredDeletes.push_back(GLDeferredDelete{ type, handle, DeferredFrame });
+
+	return true;
+}
+
+GLStateCache* GetGLState()
+{
+	return &State;
+}
+
+void ResetGLState()
+{
+	State.Program = GL_STATE_UNKNOWN;
+	State.ArrayBuffer = GL_STATE_UNKNOWN;
+	State.ElementBuffer = GL_STATE_UNKNOWN;
+	State.VertexArray = GL_STATE_UNKNOWN;
+	State.ActiveUnit = GL_STATE_UNKNOWN;
+
+	for (uint32 i = 0; i < GL_STATE_TEXTURE_UNITS; i++)
+	{
+		State.Textures[i] = GL_STATE_UNKNOWN;
+	}
+}
+
+void ResetGLStateCounters()
+{
+	State.Issued = 0;
+	State.Skipped = 0;
+}
+
+void UseProgram(uint32 program)
+{
+	if (State.Program == program)
+	{
+		State.Skipped++;
+		return;
+	}
+
+	glUseProgram(program);
+
+	State.Program = program;
+	State.Issued++;
+}
+
+void BindBuffer(uint32 target, uint32 buffer)
+{
+	uint32 *bound = NULL;
+
+	if (target == GL_ARRAY_BUFFER)
+	{
+		bound = &State.ArrayBuffer;
+	}
+	else if (target == GL_ELEMENT_ARRAY_BUFFER)
+	{
+		bound = &State.ElementBuffer;
+	}
+
+	if (bound && *bound == buffer)
+	{
+		State.Skipped++;
+		return;
+	}
+
+	glBindBuffer(target, buffer);
+
+	if (bound)
+	{
+		*bound = buffer;
+	}
+
+	State.Issued++;
+}
+
+void BindVertexArray(uint32 vertexArray)
+{
+	if (State.VertexArray == vertexArray)
+	{
+		State.Skipped++;
+		return;
+	}
+
+	glBindVertexArray(vertexArray);
+
+	State.VertexArray = vertexArray;
+	State.ElementBuffer = GL_STATE_UNKNOWN;
+	State.Issued++;
+}
+
+void BindTexture2D(uint32 unit, uint32 texture)
+{
+	if (unit < GL_STATE_TEXTURE_UNITS && State.Textures[unit] == texture)
+	{
+		State.Skipped++;
+		return;
+	}
+
+	if (State.ActiveUnit != unit)
+	{
+		glActiveTexture(GL_TEXTURE0 + unit);
+
+		State.ActiveUnit = unit;
+		State.Issued++;
+	}
+
+	glBindTexture(GL_TEXTURE_2D, texture);
+
+	if (unit < GL_STATE_TEXTURE_UNITS)
+	{
+		State.Textures[unit] = texture;
+	}
+
+	State.Issued++;
+}
+
+void DeleteBuffer(uint32 *buffer)
+{
+	if (!*buffer)
+	{
+		return;
+	}
+
+	if (State.ArrayBuffer == *buffer)
+	{
+		State.ArrayBuffer = 0;
+	}
+
+	//NOTE(kai): only the bound vertex array's element binding is cleared, the cache can't know the others
+	if (State.ElementBuffer == *buffer)
+	{
+		State.ElementBuffer = 0;
+	}
+
+	if (!DeferDelete(DEFERRED_BUFFER, *buffer))
+	{
+		glDeleteBuffers(1, buffer);
+	}
+
+	*buffer = 0;
+}
+
+void DeleteTexture(uint32 *texture)
+{
+	if (!*texture)
+	{
+		return;
+	}
+
+	for (uint32 i = 0; i < GL_STATE_TEXTURE_UNITS; i++)
+	{
+		if (State.Textures[i] == *texture)
+		{
+			State.Textures[i] = 0;
+		}
+	}
+
+	if (!DeferDelete(DEFERRED_TEXTURE, *texture))
+	{
+		glDeleteTextures(1, texture);
+	}
+
+	*texture = 0;
+}
+
+void DeleteProgram(uint32 *program)
+{
+	if (!*program)
+	{
+		return;
+	}
+
+	//NOTE(kai): a program in use is only flagged for deletion, it stays current until something else is used
+	if (!DeferDelete(DEFERRED_PROGRAM, *program))
+	{
+		glDeleteProgram(*program);
+	}
+
+	*program = 0;
+}
+
+void DeleteVertexArray(uint32 *vertexArray)
+{
+	if (!*vertexArray)
+	{
+		return;
+	}
+
+	//NOTE(kai): deleting the bound vertex array falls back to the default one, which has its own element binding
+	if (State.VertexArray == *vertexArray)
+	{
+		State.VertexArray = 0;
+		State.ElementBuffer = GL_STATE_UNKNOWN;
+	}
+
+	if (!DeferDelete(DEFERRED_VERTEX_ARRAY, *vertexArray))
+	{
+		glDeleteVertexArrays(1, vertexArray);
+	}
+
+	*vertexArray = 0;
+}
+
+void SetGLRenderThread(std::thread::id thread)
+{
+	std::lock_guard<std::mutex> lock(DeferredLock);
+
+	RenderThread = thread;
+	DeferDeletes = true;
+}
+
+void ClearGLRenderThread()
+{
+	{
+		std::lock_guard<std::mutex> lock(DeferredLock);
+
+		DeferDeletes = false;
+	}
+
+	ReleaseDeferredDeletes(0xFFFFFFFF);
+}
+
+void SetDeferredDeleteFrame(uint32 frame)
+{
+	std::lock_guard<std::mutex> lock(DeferredLock);
+
+	DeferredFrame = frame;
+}
+
+void ReleaseDeferredDeletes(uint32 frame)
+{
+	std::vector<GLDeferredDelete> ready;
+
+	{
+		std::lock_guard<std::mutex> lock(DeferredLock);
+
+		for (uint32 i = 0; i < DeferredDeletes.size();)
+		{
+			if (DeferredDeletes[i].Frame > frame)
+			{
+				i++;
+				continue;
+			}
+
+			ready.push_back(DeferredDeletes[i]);
+
+			DeferredDeletes[i] = DeferredDeletes.back();
+			DeferredDeletes.pop_back();
+		}
+	}
+
+	//NOTE(kai): back through the calls above so this thread's cache forgets them too, they run right away here
+	for (uint32 i = 0; i < ready.size(); i++)
+	{
+		uint32 handle = ready[i].Handle;
+
+		switch (ready[i].Type)
+		{
+		case DEFERRED_BUFFER:
+		{
+			DeleteBuffer(&handle);
+		}
+		break;
+
+		case DEFERRED_TEXTURE:
+		{
+			DeleteTexture(&handle);
+		}
+		break;
+
+		case DEFERRED_PROGRAM:
+		{
+			DeleteProgram(&handle);
+		}
+		break;
+
+		case DEFERRED_VERTEX_ARRAY:
+		{
+			DeleteVertexArray(&handle);
+		}
+		break;
+		}
+	}
+}
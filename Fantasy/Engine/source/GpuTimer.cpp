@@ -0,0 +1,91 @@
+#include <GpuTimer.h>
+
+bool GpuTimersSupported()
+{
+	return GLEW_ARB_timer_query || GLEW_VERSION_3_3;
+}
+
+void BeginGpuFrame(GpuTimers *timers)
+{
+	if (!timers->Created)
+	{
+		timers->Created = true;
+		timers->Supported = GpuTimersSupported();
+		timers->Frame = 0;
+		timers->Running = -1;
+
+		if (timers->Supported)
+		{
+			glGenQueries(GPU_TIMER_FRAMES * GPU_PASS_COUNT, &timers->Queries[0][0]);
+		}
+	}
+
+	if (!timers->Supported)
+	{
+		return;
+	}
+
+	timers->Frame = (timers->Frame + 1) % GPU_TIMER_FRAMES;
+
+	for (uint32 i = 0; i < GPU_PASS_COUNT; i++)
+	{
+		//NOTE(kai): a pass that wasn't drawn that frame took no time
+		if (!timers->Pending[timers->Frame][i])
+		{
+			timers->PassTimes[i] = 0;
+			continue;
+		}
+
+		uint32 query = timers->Queries[timers->Frame][i];
+		int32 available = 0;
+
+		glGetQueryObjectiv(query, GL_QUERY_RESULT_AVAILABLE, &available);
+
+		if (available)
+		{
+			GLuint64 nanoseconds = 0;
+			glGetQueryObjectui64v(query, GL_QUERY_RESULT, &nanoseconds);
+
+			timers->PassTimes[i] = (float)(nanoseconds / 1000000.0);
+		}
+
+		timers->Pending[timers->Frame][i] = false;
+	}
+}
+
+void BeginGpuPass(GpuTimers *timers, GPU_PASS pass)
+{
+	if (!timers->Supported || timers->Running >= 0)
+	{
+		return;
+	}
+
+	glBeginQuery(GL_TIME_ELAPSED, timers->Queries[timers->Frame][pass]);
+
+	timers->Running = pass;
+}
+
+void EndGpuPass(GpuTimers *timers)
+{
+	if (timers->Running < 0)
+	{
+		return;
+	}
+
+	glEndQuery(GL_TIME_ELAPSED);
+
+	timers->Pending[timers->Frame][timers->Running] = true;
+	timers->Running = -1;
+}
+
+float GetGpuFrameTime(GpuTimers *timers)
+{
+	float total = 0;
+
+	for (uint32 i = 0; i < GPU_PASS_COUNT; i++)
+	{
+		total += timers->PassTimes[i];
+	}
+
+	return total;
+}
\ No newline at end of file
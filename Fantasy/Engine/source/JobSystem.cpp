@@ -0,0 +1,137 @@
+#include <JobSystem.h>
+
+void JobSystem::Init(uint32 threadCount)
+{
+	if (threadCount == 0)
+	{
+		uint32 cores = std::thread::hardware_concurrency();
+		threadCount = cores > 1 ? cores - 1 : 0;
+	}
+
+	if (threadCount > MAX_JOB_THREADS - 1)
+	{
+		threadCount = MAX_JOB_THREADS - 1;
+	}
+
+	Callback = NULL;
+	Data = NULL;
+	Count = 0;
+	BatchSize = 1;
+	NextItem = 0;
+	Generation = 0;
+	BusyWorkers = 0;
+	Running = true;
+
+	for (uint32 i = 0; i < threadCount; i++)
+	{
+		Workers.push_back(std::thread(&JobSystem::WorkerLoop, this, i + 1));
+	}
+}
+
+void JobSystem::Destroy()
+{
+	{
+		std::unique_lock<std::mutex> lock(Lock);
+		Running = false;
+	}
+
+	WorkReady.notify_all();
+
+	for (uint32 i = 0; i < Workers.size(); i++)
+	{
+		Workers[i].join();
+	}
+
+	Workers.clear();
+}
+
+uint32 JobSystem::GetThreadCount()
+{
+	return (uint32)Workers.size() + 1;
+}
+
+void JobSystem::RunBatches(uint32 threadIndex)
+{
+	for (;;)
+	{
+		uint32 begin = NextItem.fetch_add(BatchSize);
+
+		if (begin >= Count)
+		{
+			break;
+		}
+
+		uint32 end = begin + BatchSize < Count ? begin + BatchSize : Count;
+
+		Callback(Data, begin, end, threadIndex);
+	}
+}
+
+void JobSystem::WorkerLoop(uint32 threadIndex)
+{
+	uint32 generation = 0;
+
+	for (;;)
+	{
+		{
+			std::unique_lock<std::mutex> lock(Lock);
+			WorkReady.wait(lock, [this, generation]{ return !Running || Generation != generation; });
+
+			if (!Running)
+			{
+				return;
+			}
+
+			generation = Generation;
+		}
+
+		RunBatches(threadIndex);
+
+		{
+			std::unique_lock<std::mutex> lock(Lock);
+			BusyWorkers--;
+		}
+
+		WorkDone.notify_one();
+	}
+}
+
+void JobSystem::ParallelFor(uint32 count, uint32 batchSize, JobCallback *callback, void *data)
+{
+	if (count == 0)
+	{
+		return;
+	}
+
+	if (batchSize == 0)
+	{
+		batchSize = 1;
+	}
+
+	//NOTE(kai): not worth waking anyone up
+	if (Workers.empty() || count <= batchSize)
+	{
+		callback(data, 0, count, 0);
+
+		return;
+	}
+
+	{
+		std::unique_lock<std::mutex> lock(Lock);
+		Callback = callback;
+		Data = data;
+		Count = count;
+		BatchSize = batchSize;
+		NextItem = 0;
+		BusyWorkers = (uint32)Workers.size();
+		Generation++;
+	}
+
+	WorkReady.notify_all();
+
+	RunBatches(0);
+
+	//NOTE(kai): every worker has to check in before the job data can change again
+	std::unique_lock<std::mutex> lock(Lock);
+	WorkDone.wait(lock, [this]{ return BusyWorkers == 0; });
+}
@@ -1,5 +1,6 @@
 #include "Mesh.h"
 #include <stdint.h>
+#include <vector>
 
 Mesh CreateMesh(Vertex *vertices, unsigned int verticesCount
 	, unsigned int *indices, unsigned int indicesCount, bool withNormals, bool batch)
@@ -36,36 +37,79 @@ Mesh CreateMesh(Vertex *vertices, unsigned int verticesCount
 	return mesh;
 }
 
-void BindMesh(Mesh *mesh)
+//NOTE(kai): writes the attribute layout into whatever vertex array is bound
+file_internal void SetMeshAttributes(Mesh *mesh, uint32 baseOffset)
 {
-	glBindBuffer(GL_ARRAY_BUFFER, mesh->VBO);
-
-	glEnableVertexAttribArray(0);
-	glEnableVertexAttribArray(1);
-	glEnableVertexAttribArray(2);
-	glEnableVertexAttribArray(3);
-	glEnableVertexAttribArray(4);
-
-	glVertexAttribPointer(0			
-		, 3				
-		, GL_FLOAT		
-		, GL_FALSE		
-		, sizeof(Vertex)
-		, (void *)offsetof(Vertex, Vertex::Pos));		
-
-	glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void *)offsetof(Vertex, Vertex::TexCoords));
-	glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void *)offsetof(Vertex, Vertex::Color));
-	glVertexAttribPointer(3, 1, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void *)offsetof(Vertex, Vertex::TextureSlot));
-	glVertexAttribPointer(4, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void *)(offsetof(Vertex, Vertex::Normal)));
-
-	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh->EBO);
+	BindBuffer(GL_ARRAY_BUFFER, mesh->VBO);
+
+	SetVertexAttributes(mesh->Format ? mesh->Format : GetMeshVertexFormat(), baseOffset);
+
+	BindBuffer(GL_ELEMENT_ARRAY_BUFFER, mesh->EBO);
+}
+
+bool VertexArraysSupported()
+{
+	return GLEW_VERSION_3_0 || GLEW_ARB_vertex_array_object ? true : false;
+}
+
+void BindMeshLayout(VertexLayout *layout, Mesh *mesh, uint32 baseOffset)
+{
+	if (!VertexArraysSupported())
+	{
+		SetMeshAttributes(mesh, baseOffset);
+		return;
+	}
+
+	if (!layout->Handle)
+	{
+		glGenVertexArrays(1, &layout->Handle);
+	}
+
+	BindVertexArray(layout->Handle);
+
+	if (layout->VBO != mesh->VBO || layout->EBO != mesh->EBO || layout->BaseOffset != baseOffset
+		|| layout->Format != mesh->Format)
+	{
+		SetMeshAttributes(mesh, baseOffset);
+
+		layout->VBO = mesh->VBO;
+		layout->EBO = mesh->EBO;
+		layout->BaseOffset = baseOffset;
+		layout->Format = mesh->Format;
+	}
+
+	//NOTE(kai): the array buffer binding isn't part of the vertex array, callers still expect it to be the mesh's
+	BindBuffer(GL_ARRAY_BUFFER, mesh->VBO);
+}
+
+void ResetMeshLayout(VertexLayout *layout)
+{
+	layout->VBO = 0;
+	layout->EBO = 0;
+	layout->BaseOffset = 0;
+}
+
+void UnbindVertexArray()
+{
+	if (VertexArraysSupported())
+	{
+		BindVertexArray(0);
+	}
+}
+
+void BindMesh(Mesh *mesh, uint32 baseOffset)
+{
+	BindMeshLayout(&mesh->Layout, mesh, baseOffset);
 }
 
 void UnbindMesh()
 {
-	glBindBuffer(GL_ARRAY_BUFFER, 0);
+	//NOTE(kai): the element buffer unbind would otherwise come out of the bound vertex array
+	UnbindVertexArray();
 
-	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+	BindBuffer(GL_ARRAY_BUFFER, 0);
+
+	BindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
 }
 
 void DrawMesh(Mesh *mesh, bool debug)
@@ -169,6 +213,11 @@ void EditSprite(Mesh *sprite, vec3f pos, vec3f size, vec4f color)
 	UnbindMesh();
 }
 
+void EditSprite(Sprite *sprite, vec4f color)
+{
+	sprite->Color = color;
+}
+
 Mesh CreateCube(vec3f pos, vec3f size, vec4f color, bool withNormals)
 {
 	Vertex vertices[24] =
@@ -288,63 +337,96 @@ void EditNormals(Mesh *buffers)
 	UnbindMesh();
 }
 
-void BeginBatch(MeshBatch *batch, BATCH_TYPE type, uint32 maxCount, bool debug)
+void ReserveQuadIndices(QuadIndexBuffer *indices, uint32 quadCount, bool lines)
 {
-	batch->MaxCount = maxCount;
+	if (indices->Handle && indices->Capacity >= quadCount && indices->Lines == lines)
+	{
+		return;
+	}
 
-	if (batch->Type == BATCH_TYPE::UNKNOWN && type != BATCH_TYPE::UNKNOWN)
+	uint32 capacity = indices->Capacity ? indices->Capacity : 256;
+
+	while (capacity < quadCount)
 	{
-		batch->Type = type;
+		capacity *= 2;
 	}
 
-	if (type = BATCH_TYPE::SPRITE_BATCH)
+	uint32 perQuad = lines ? 8 : 6;
+	std::vector<uint32> data(capacity * perQuad);
+
+	for (uint32 i = 0; i < capacity; i++)
 	{
-		if (debug)
+		uint32 vertex = i * 4;
+		uint32 *quad = &data[i * perQuad];
+
+		if (lines)
 		{
-			if (!batch->Batch.VBO)
-			{
-				batch->Batch = CreateMesh(NULL, 4 * batch->MaxCount, NULL, 8 * batch->MaxCount, false, true);
-			}
+			quad[0] = vertex + 0;
+			quad[1] = vertex + 1;
 
-			BindMesh(&batch->Batch);
+			quad[2] = vertex + 1;
+			quad[3] = vertex + 2;
 
-			//Store the data in the buffer
-			glBufferData(GL_ARRAY_BUFFER, 4 * batch->MaxCount * sizeof(Vertex), NULL, GL_DYNAMIC_DRAW);
+			quad[4] = vertex + 2;
+			quad[5] = vertex + 3;
 
-			//Store the data in the buffer
-			glBufferData(GL_ELEMENT_ARRAY_BUFFER, 8 * batch->MaxCount * sizeof(unsigned int), NULL, GL_DYNAMIC_DRAW);
+			quad[6] = vertex + 3;
+			quad[7] = vertex + 0;
 		}
 		else
 		{
-			if (!batch->Batch.VBO)
-			{
-				batch->Batch = CreateMesh(NULL, 4 * batch->MaxCount, NULL, 6 * batch->MaxCount, false, true);
-			}
+			quad[0] = vertex + 0;
+			quad[1] = vertex + 1;
+			quad[2] = vertex + 3;
 
-			BindMesh(&batch->Batch);
+			quad[3] = vertex + 1;
+			quad[4] = vertex + 2;
+			quad[5] = vertex + 3;
+		}
+	}
 
-			//Store the data in the buffer
-			glBufferData(GL_ARRAY_BUFFER, 4 * batch->MaxCount * sizeof(Vertex), NULL, GL_DYNAMIC_DRAW);
+	if (!indices->Handle)
+	{
+		glGenBuffers(1, &indices->Handle);
+	}
 
-			//Store the data in the buffer
-			glBufferData(GL_ELEMENT_ARRAY_BUFFER, 6 * batch->MaxCount * sizeof(unsigned int), NULL, GL_DYNAMIC_DRAW);
-		}
+	UnbindVertexArray();
+
+	BindBuffer(GL_ELEMENT_ARRAY_BUFFER, indices->Handle);
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, data.size() * sizeof(uint32), data.data(), GL_STATIC_DRAW);
+
+	indices->Capacity = capacity;
+	indices->Lines = lines;
+}
+
+void BeginBatch(MeshBatch *batch, BATCH_TYPE type, uint32 maxCount, bool debug)
+{
+	batch->MaxCount = maxCount;
+	batch->CurrentSize = 0;
+	batch->Write = NULL;
+
+	if (batch->Type == BATCH_TYPE::UNKNOWN && type != BATCH_TYPE::UNKNOWN)
+	{
+		batch->Type = type;
 	}
-	else
+
+	if (!maxCount)
 	{
-		if (!batch->Batch.VBO)
+		return;
+	}
+
+	//NOTE(kai): the vertices go straight into the stream, only the index pattern lives in a static buffer
+	if (ReserveStream(&batch->Stream, GL_ARRAY_BUFFER, 4 * maxCount * sizeof(Vertex)))
+	{
+		for (uint32 i = 0; i < STREAM_BUFFER_FRAMES; i++)
 		{
-			batch->Batch = CreateMesh(NULL, 24 * batch->MaxCount, NULL, 36 * batch->MaxCount, false, true);
+			ResetMeshLayout(&batch->Layouts[i]);
 		}
+	}
 
-		BindMesh(&batch->Batch);
-
-		//Store the data in the buffer
-		glBufferData(GL_ARRAY_BUFFER, 24 * batch->MaxCount * sizeof(Vertex), NULL, GL_DYNAMIC_DRAW);
+	ReserveQuadIndices(&batch->Indices, maxCount, debug);
 
-		//Store the data in the buffer
-		glBufferData(GL_ELEMENT_ARRAY_BUFFER, 36 * batch->MaxCount * sizeof(unsigned int), NULL, GL_DYNAMIC_DRAW);
-	}
+	batch->Write = (Vertex *)BeginStream(&batch->Stream, &batch->WriteOffset);
 }
 
 void PauseBatch(MeshBatch *batch)
@@ -354,8 +436,6 @@ void PauseBatch(MeshBatch *batch)
 
 void ResumeBatch(MeshBatch *batch)
 {
-	BindMesh(&batch->Batch);
-
 	for (uint32 i = 0; i < batch->UsedSlotsCount; i++)
 	{
 		batch->TextureSlots[i] = 0;
@@ -366,166 +446,81 @@ void ResumeBatch(MeshBatch *batch)
 
 void AddSprite(MeshBatch *batch, vec3f pos, vec3f size, vec4f color, uint32 textureID, bool debug, mat4f model)
 {
-	uint32 vertexOffset = batch->CurrentSize * 4;
-	uint32 indexOffset = batch->CurrentSize * 6;
-	if (debug)
+	if (batch->CurrentSize >= batch->MaxCount)
 	{
-		indexOffset = batch->CurrentSize * 8;
+		return;
 	}
 
+	Vertex *vertices = batch->Write + batch->CurrentSize * 4;
+
 	batch->CurrentSize++;
 
 	float slotIndex = 0;
-	/*
-	bool found = false;
-
-	for (uint32 i = 0; i < batch->UsedSlotsCount; i++)
-	{
-		if (batch->TextureSlots[i] == textureID)
-		{
-			found = true;
-			slotIndex = i;
-			break;
-		}
-	}
-
-	if (!found)
-	{
-		if (batch->UsedSlotsCount >= 8)
-		{
-			PauseBatch(batch);
-			RenderBatch(batch, debug);
-			ResumeBatch(batch);
-		}
 
-		batch->TextureSlots[batch->UsedSlotsCount] = textureID;
-		slotIndex = batch->UsedSlotsCount;
-		batch->UsedSlotsCount++;
-	}*/
-	if (!debug)
-	{
-		{
-			vec3f lowerLeft = vec3f(pos.X - (size.X / 2.0f), pos.Y - (size.Y / 2.0f), pos.Z);
-			vec3f upperLeft = vec3f(pos.X - (size.X / 2.0f), pos.Y + (size.Y / 2.0f), pos.Z);
-			vec3f lowerRight = vec3f(pos.X + (size.X / 2.0f), pos.Y - (size.Y / 2.0f), pos.Z);
-			vec3f upperRight = vec3f(pos.X + (size.X / 2.0f), pos.Y + (size.Y / 2.0f), pos.Z);
+	vec3f lowerLeft = vec3f(pos.X - (size.X / 2.0f), pos.Y - (size.Y / 2.0f), pos.Z);
+	vec3f upperLeft = vec3f(pos.X - (size.X / 2.0f), pos.Y + (size.Y / 2.0f), pos.Z);
+	vec3f lowerRight = vec3f(pos.X + (size.X / 2.0f), pos.Y - (size.Y / 2.0f), pos.Z);
+	vec3f upperRight = vec3f(pos.X + (size.X / 2.0f), pos.Y + (size.Y / 2.0f), pos.Z);
 
-			if (!batch->Stop)
-			{
-				lowerLeft = model * lowerLeft;
-				upperLeft = model * upperLeft;
-				lowerRight = model * lowerRight;
-				upperRight = model * upperRight;
-			}
-			
-			Vertex vertices[] =
-			{
-				Vertex{ lowerLeft, vec2f(0, 0), color, slotIndex },
-				Vertex{ upperLeft, vec2f(0, 1), color, slotIndex },
-				Vertex{ upperRight, vec2f(1, 1), color, slotIndex },
-				Vertex{ lowerRight, vec2f(1, 0), color, slotIndex }
-			};
-			glBufferSubData(GL_ARRAY_BUFFER, vertexOffset * sizeof(Vertex), 4 * sizeof(Vertex), vertices);
-		}
-	}
-	else
+	if (!batch->Stop)
 	{
-		vec3f lowerLeft = vec3f(pos.X - (size.X / 2.0f), pos.Y - (size.Y / 2.0f), pos.Z);
-		vec3f upperLeft = vec3f(pos.X - (size.X / 2.0f), pos.Y + (size.Y / 2.0f), pos.Z);
-		vec3f lowerRight = vec3f(pos.X + (size.X / 2.0f), pos.Y - (size.Y / 2.0f), pos.Z);
-		vec3f upperRight = vec3f(pos.X + (size.X / 2.0f), pos.Y + (size.Y / 2.0f), pos.Z);
-
-		if (!batch->Stop)
-		{
-			lowerLeft = model * lowerLeft;
-			upperLeft = model * upperLeft;
-			lowerRight = model * lowerRight;
-			upperRight = model * upperRight;
-		}
-
-		Vertex vertices[] =
-		{
-			Vertex{ lowerLeft, vec2f(0, 0), color },
-			Vertex{ upperLeft, vec2f(0, 1), color },
-			Vertex{ upperRight, vec2f(1, 1), color },
-			Vertex{ lowerRight, vec2f(1, 0), color }
-		};
-		glBufferSubData(GL_ARRAY_BUFFER, vertexOffset * sizeof(Vertex), 4 * sizeof(Vertex), vertices);
+		lowerLeft = model * lowerLeft;
+		upperLeft = model * upperLeft;
+		lowerRight = model * lowerRight;
+		upperRight = model * upperRight;
 	}
 
-	if (debug)
+	if (!debug)
 	{
-		uint32 indices[] =
-		{
-			0 + vertexOffset,
-			1 + vertexOffset,
-
-			1 + vertexOffset,
-			2 + vertexOffset,
-
-			2 + vertexOffset,
-			3 + vertexOffset,
-
-			3 + vertexOffset,
-			0 + vertexOffset,
-		};
-
-		glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, indexOffset * sizeof(uint32), 8 * sizeof(uint32), indices);
+		vertices[0] = Vertex{ lowerLeft, vec2f(0, 0), color, slotIndex };
+		vertices[1] = Vertex{ upperLeft, vec2f(0, 1), color, slotIndex };
+		vertices[2] = Vertex{ upperRight, vec2f(1, 1), color, slotIndex };
+		vertices[3] = Vertex{ lowerRight, vec2f(1, 0), color, slotIndex };
 	}
 	else
 	{
-		uint32 indices[] =
-		{
-			0 + vertexOffset,
-			1 + vertexOffset,
-			3 + vertexOffset,
-
-			1 + vertexOffset,
-			2 + vertexOffset,
-			3 + vertexOffset
-		};
-
-		glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, indexOffset * sizeof(uint32), 6 * sizeof(uint32), indices);
+		vertices[0] = Vertex{ lowerLeft, vec2f(0, 0), color };
+		vertices[1] = Vertex{ upperLeft, vec2f(0, 1), color };
+		vertices[2] = Vertex{ upperRight, vec2f(1, 1), color };
+		vertices[3] = Vertex{ lowerRight, vec2f(1, 0), color };
 	}
 }
 
 void EndBatch(MeshBatch *batch, bool debug)
 {
-	UnbindMesh();
-	RenderBatch(batch, debug);
+	if (batch->Write)
+	{
+		EndStream(&batch->Stream, batch->CurrentSize * 4 * sizeof(Vertex));
+		RenderBatch(batch, debug);
+		FenceStream(&batch->Stream);
+	}
+
 	batch->CurrentSize = 0;
+	batch->Write = NULL;
 }
 
 void RenderBatch(MeshBatch *batch, bool debug)
 {
-	/*for (uint32 i = 0; i < batch->UsedSlotsCount; i++)
+	if (!batch->CurrentSize)
 	{
-		glActiveTexture(GL_TEXTURE0 + i);
-		glBindTexture(GL_TEXTURE_2D, batch->TextureSlots[i]);
-	}*/
+		return;
+	}
+
+	Mesh buffers = {};
+	buffers.VBO = batch->Stream.Handle;
+	buffers.EBO = batch->Indices.Handle;
+
+	BindMeshLayout(&batch->Layouts[batch->Stream.Region], &buffers, batch->WriteOffset);
 
 	if (debug)
 	{
 		glLineWidth(1.0f);
-		BindMesh(&batch->Batch);
-		glDrawElements(GL_LINES, batch->Batch.IndicesCount, GL_UNSIGNED_INT, NULL);
-		UnbindMesh();
+		glDrawElements(GL_LINES, batch->CurrentSize * 8, GL_UNSIGNED_INT, NULL);
 	}
 	else
 	{
-		DrawMesh(&batch->Batch, false);
+		glDrawElements(GL_TRIANGLES, batch->CurrentSize * 6, GL_UNSIGNED_INT, NULL);
 	}
 
-	glBindTexture(GL_TEXTURE_2D, 0);
-}
-
-void DrawSprite(Sprite *sprite)
-{
-	if (!sprite->Buffers.VBO)
-	{
-		sprite->Buffers = CreateSprite(sprite->Pos, sprite->Size, sprite->Skin.MeshColor, true, false);
-	}
-	BindTexture(&sprite->Skin.MeshTexture);
-	DrawMesh(&sprite->Buffers, false);
-	UnbindTexture();
+	//NOTE(kai): the buffers stay bound, the next batch's binds go through the state cache and skip them
 }
\ No newline at end of file
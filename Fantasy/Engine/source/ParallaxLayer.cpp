@@ -0,0 +1,70 @@
+#include <ParallaxLayer.h>
+#include <math.h>
+
+ParallaxLayer::ParallaxLayer(char *name, Sprite sprite, float scrollFactor, uint8 renderLayer)
+{
+	this->Type = "PARALLAX";
+	this->Name = name;
+	this->SpriteData = sprite;
+	this->SpriteData.UVRect = vec4f(0, 0, 1, 1);
+	this->SpriteData.Color = sprite.Skin.MeshColor;
+	this->ScrollFactor = scrollFactor;
+	this->RenderLayer = renderLayer;
+	this->Origin = vec3f();
+	this->CameraStart = 0.0f;
+	this->Size = sizeof(ParallaxLayer);
+}
+
+void ParallaxLayer::PreInit()
+{
+	SpriteData.Owner = Owner;
+}
+
+void ParallaxLayer::Init()
+{
+	Origin = Owner->ObjectTransform.Position;
+	CameraStart = Scene->MainCamera.Eye.X;
+}
+
+uint32 PushParallaxLayer(RenderQueue *queue, ParallaxLayer *layer, BoundingRect *view, float cameraX, uint32 order)
+{
+	Sprite *sprite = &layer->SpriteData;
+
+	float width = sprite->Size.X;
+	float halfHeight = sprite->Size.Y / 2.0f;
+	float y = layer->Origin.Y + sprite->Pos.Y;
+
+	if (width <= 0.0f || y + halfHeight < view->MinY || y - halfHeight > view->MaxY)
+	{
+		return 0;
+	}
+
+	float offset = layer->Origin.X + sprite->Pos.X + (cameraX - layer->CameraStart) * layer->ScrollFactor;
+
+	//NOTE(kai): copy k is centered on offset + k * width
+	float camera = floorf((cameraX - offset) / width + 0.5f);
+	float first = floorf((view->MinX - offset) / width + 0.5f);
+	float last = floorf((view->MaxX - offset) / width + 0.5f);
+
+	first = max(first, camera - PARALLAX_MAX_COPIES / 2);
+	last = min(last, camera + PARALLAX_MAX_COPIES / 2);
+
+	uint32 count = 0;
+
+	for (int32 k = (int32)first; k <= (int32)last; k++)
+	{
+		float mirror = (k & 1) ? -1.0f : 1.0f;
+
+		//NOTE(kai): the mirror flips the sprite's own offset too, the translation makes up for it
+		vec3f position = vec3f(offset + k * width - mirror * sprite->Pos.X, layer->Origin.Y, layer->Origin.Z);
+		vec3f scale = vec3f(mirror, 1.0f, 1.0f);
+
+		mat4f model = Mat4::Translation(position) * Mat4::Scale(scale);
+
+		PushRenderItem(queue, sprite, &model, layer->RenderLayer, order);
+
+		count++;
+	}
+
+	return count;
+}
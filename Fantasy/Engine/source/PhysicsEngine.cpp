@@ -1,126 +1,1246 @@
 #include <SceneManager.h>
 #include <PhysicsEngine.h>
+#include <TileCollider.h>
 #include <iostream>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
 
 void PhysicsEngine::Init()
 {
 	CollidedNamesPool = Cinder::Memory::MemoryPool(sizeof(CollidedPair), 8, false);
 	ph.acceleration = 60.0f;
 	ph.Gravity = 4.0f;
+
+	for (uint32 i = 0; i < MAX_COLLISION_LAYERS; i++)
+	{
+		LayerNames[i] = NULL;
+		LayerMatrix[i] = 0xFFFFFFFF;
+	}
+
+	LayerNames[0] = "Default";
+	LayerCount = 1;
+
+	ContinuousSkin = 0.01f;
+	ContinuousIterations = 4;
+
+	SleepVelocity = 0.01f;
+	SleepTicks = 30;
+
+	FixedDelta = 1.0f / 60.0f;
+	Substeps = 1;
+	MaxSteps = 8;
+	Accumulator = 0.0f;
+	Alpha = 0.0f;
+	Gravity = vec2f(0.0f, -2400.0f);
+
+	Stats = {};
+}
+
+uint32 PhysicsEngine::AddLayer(char *name)
+{
+	uint32 bits = GetLayerBits(name);
+
+	if (bits)
+	{
+		return bits;
+	}
+
+	if (LayerCount == MAX_COLLISION_LAYERS)
+	{
+		std::cout << "Out of collision layers, " << name << " uses the default layer" << std::endl;
+
+		return 1;
+	}
+
+	LayerNames[LayerCount] = name;
+
+	return 1u << LayerCount++;
+}
+
+uint32 PhysicsEngine::GetLayerBits(char *name)
+{
+	if (!name || !*name)
+	{
+		return 1;
+	}
+
+	for (uint32 i = 0; i < LayerCount; i++)
+	{
+		if (LayerNames[i] == name || strcmp(LayerNames[i], name) == 0)
+		{
+			return 1u << i;
+		}
+	}
+
+	return 0;
+}
+
+void PhysicsEngine::SetLayerCollision(char *layer1, char *layer2, bool collide)
+{
+	uint32 bits1 = AddLayer(layer1);
+	uint32 bits2 = AddLayer(layer2);
+
+	for (uint32 i = 0; i < LayerCount; i++)
+	{
+		if (bits1 & (1u << i))
+		{
+			LayerMatrix[i] = collide ? (LayerMatrix[i] | bits2) : (LayerMatrix[i] & ~bits2);
+		}
+
+		if (bits2 & (1u << i))
+		{
+			LayerMatrix[i] = collide ? (LayerMatrix[i] | bits1) : (LayerMatrix[i] & ~bits1);
+		}
+	}
+}
+
+uint32 PhysicsEngine::GetLayerMask(uint32 layerBits)
+{
+	uint32 mask = 0;
+
+	for (uint32 i = 0; i < LayerCount; i++)
+	{
+		if (layerBits & (1u << i))
+		{
+			mask |= LayerMatrix[i];
+		}
+	}
+
+	return mask;
+}
+
+void PhysicsEngine::WakeCollider(Collider *collider)
+{
+	collider->sleeping = false;
+	collider->idleTicks = 0;
+}
+
+bool PhysicsEngine::UpdateSleep(Collider *collider)
+{
+	if (collider->isStatic)
+	{
+		return true;
+	}
+
+	//NOTE(kai): game code moves transforms directly, so the distance since last tick counts as much as the velocity
+	float movedX = collider->pos->X - collider->restPos.X;
+	float movedY = collider->pos->Y - collider->restPos.Y;
+	collider->restPos = collider->pos->XY();
+
+	if (abs(collider->velocity.X) > SleepVelocity || abs(collider->velocity.Y) > SleepVelocity
+		|| abs(movedX) > SleepVelocity || abs(movedY) > SleepVelocity)
+	{
+		WakeCollider(collider);
+
+		return false;
+	}
+
+	if (!collider->sleeping && ++collider->idleTicks >= SleepTicks)
+	{
+		collider->sleeping = true;
+	}
+
+	return collider->sleeping;
+}
+
+BroadphaseProxy PhysicsEngine::MakeProxy(Collider *collider, bool sweeping, bool resting, vec2f start)
+{
+	//NOTE(kai): fatten the box by the velocity so the swept test can't miss a pair
+	vec2f center = vec2f(collider->pos->X + collider->offset.X, collider->pos->Y + collider->offset.Y);
+	vec2f extent = vec2f(collider->size.X / 2.0f + abs(collider->velocity.X),
+						 collider->size.Y / 2.0f + abs(collider->velocity.Y));
+
+	BroadphaseProxy proxy;
+	proxy.MinX = center.X - extent.X;
+	proxy.MinY = center.Y - extent.Y;
+	proxy.MaxX = center.X + extent.X;
+	proxy.MaxY = center.Y + extent.Y;
+	proxy.LayerBits = collider->layerBits;
+	proxy.MaskBits = collider->maskBits & GetLayerMask(collider->layerBits);
+	proxy.Resting = resting;
+	proxy.Owner = collider;
+
+	if (sweeping)
+	{
+		//NOTE(kai): and cover the whole path for the continuous sweep
+		float oldX = start.X + collider->offset.X;
+		float oldY = start.Y + collider->offset.Y;
+
+		proxy.MinX = min(proxy.MinX, oldX - collider->size.X / 2.0f);
+		proxy.MinY = min(proxy.MinY, oldY - collider->size.Y / 2.0f);
+		proxy.MaxX = max(proxy.MaxX, oldX + collider->size.X / 2.0f);
+		proxy.MaxY = max(proxy.MaxY, oldY + collider->size.Y / 2.0f);
+	}
+
+	return proxy;
+}
+
+bool PhysicsEngine::NeedsSweep(Collider *collider, vec2f start)
+{
+	if (!collider->continuous)
+	{
+		return false;
+	}
+
+	//NOTE(kai): slow bodies can't skip over anything, the discrete test is enough for them
+	float pathX = collider->pos->X - start.X;
+	float pathY = collider->pos->Y - start.Y;
+
+	return abs(pathX) > collider->size.X / 2.0f || abs(pathY) > collider->size.Y / 2.0f;
+}
+
+void PhysicsEngine::BuildCandidates()
+{
+	uint32 count = (uint32)BPhase.Proxies.size();
+
+	CandidateStart.assign(count + 1, 0);
+
+	for (uint32 i = 0; i < Pairs.size(); i++)
+	{
+		CandidateStart[Pairs[i].A + 1]++;
+		CandidateStart[Pairs[i].B + 1]++;
+	}
+
+	for (uint32 i = 0; i < count; i++)
+	{
+		CandidateStart[i + 1] += CandidateStart[i];
+	}
+
+	CandidateCursor.assign(CandidateStart.begin(), CandidateStart.end() - 1);
+	Candidates.resize(Pairs.size() * 2);
+
+	for (uint32 i = 0; i < Pairs.size(); i++)
+	{
+		Candidates[CandidateCursor[Pairs[i].A]++] = Pairs[i].B;
+		Candidates[CandidateCursor[Pairs[i].B]++] = Pairs[i].A;
+	}
+}
+
+void PhysicsEngine::AddCollidedPair(Collider *collider1, Collider *collider2)
+{
+	CollidedPair *cp = (CollidedPair *)CollidedNamesPool.Alloc();
+	if (cp)
+	{
+		*cp = CollidedPair{ collider1->Owner->Name, collider2->Owner->Name };
+		Colliders.push_back(cp);
+	}
+}
+
+file_internal bool IsBlocking(Collider *A, Collider *B)
+{
+	if (A->trigger || B->trigger)
+	{
+		return A->ground || A->wall || B->ground || B->wall;
+	}
+
+	return true;
+}
+
+void PhysicsEngine::ReportSweepTrigger(Collider *A, Collider *B, uint32 candidate)
+{
+	if (std::find(SweepTriggers.begin(), SweepTriggers.end(), candidate) == SweepTriggers.end())
+	{
+		SweepTriggers.push_back(candidate);
+		A->detected = true;
+		B->detected = true;
+		WakeCollider(B);
+		AddCollidedPair(A, B);
+	}
+}
+
+void PhysicsEngine::ApplySweepHit(Collider *A, Collider *hit, float normalX, float normalY)
+{
+	if (normalX != 0.0f)
+	{
+		if (A->wall)
+		{
+			A->jump = true;
+		}
+		else if (hit->wall)
+		{
+			hit->jump = true;
+		}
+
+		A->rigth = A->rigth || normalX < 0.0f;
+		A->left = A->left || normalX > 0.0f;
+		hit->left = hit->left || normalX < 0.0f;
+		hit->rigth = hit->rigth || normalX > 0.0f;
+		A->velocity.X = 0.0f;
+	}
+	else
+	{
+		A->up = A->up || normalY < 0.0f;
+		A->down = A->down || normalY > 0.0f;
+		hit->down = hit->down || normalY < 0.0f;
+		hit->up = hit->up || normalY > 0.0f;
+		A->velocity.Y = 0.0f;
+	}
+
+	A->normal = vec2f(normalX, normalY);
+	hit->normal = vec2f(-normalX, -normalY);
+	A->detected = true;
+	hit->detected = true;
+	WakeCollider(hit);
+	AddCollidedPair(A, hit);
+}
+
+void PhysicsEngine::SweepContinuous(uint32 index)
+{
+	Collider *A = BPhase.Proxies[index].Owner;
+	CollisionBatch batch;
+
+	float halfX = Bodies.HalfX[index];
+	float halfY = Bodies.HalfY[index];
+	float x = PathStart[index].X + A->offset.X;
+	float y = PathStart[index].Y + A->offset.Y;
+	float motionX = Bodies.CenterX[index] - x;
+	float motionY = Bodies.CenterY[index] - y;
+
+	uint32 first = CandidateStart[index];
+	uint32 count = CandidateStart[index + 1] - first;
+
+	SweepTriggers.clear();
+
+	//NOTE(kai): the sweep only finds boxes A moves into, the ones its start pose is already inside are
+	//			 handled here, blocking ones push A out along the axis with the least overlap
+	for (uint32 k = 0; k < count; k++)
+	{
+		uint32 other = Candidates[first + k];
+		float dx = Bodies.CenterX[other] - x;
+		float dy = Bodies.CenterY[other] - y;
+		float overlapX = halfX + Bodies.HalfX[other] - abs(dx);
+		float overlapY = halfY + Bodies.HalfY[other] - abs(dy);
+
+		if (overlapX <= 0.0f || overlapY <= 0.0f)
+		{
+			continue;
+		}
+
+		Collider *B = BPhase.Proxies[other].Owner;
+
+		if (!IsBlocking(A, B))
+		{
+			ReportSweepTrigger(A, B, first + k);
+
+			continue;
+		}
+
+		if (overlapX < overlapY)
+		{
+			float normalX = dx > 0.0f ? -1.0f : 1.0f;
+
+			x += normalX * (overlapX + ContinuousSkin);
+			ApplySweepHit(A, B, normalX, 0.0f);
+		}
+		else
+		{
+			float normalY = dy > 0.0f ? -1.0f : 1.0f;
+
+			y += normalY * (overlapY + ContinuousSkin);
+			ApplySweepHit(A, B, 0.0f, normalY);
+		}
+	}
+
+	//NOTE(kai): move to the first impact, drop the motion into the surface and sweep what's left
+	for (uint32 iteration = 0; iteration < ContinuousIterations; iteration++)
+	{
+		Collider *hit = NULL;
+		float hitTime = 1.0f;
+		float hitNormalX = 0.0f;
+		float hitNormalY = 0.0f;
+
+		for (uint32 start = 0; start < count; start += COLLISION_BATCH_SIZE)
+		{
+			uint32 batchCount = count - start < COLLISION_BATCH_SIZE ? count - start : COLLISION_BATCH_SIZE;
+
+			GatherBatch(&batch, &Bodies, &Candidates[first + start], batchCount);
+
+			//NOTE(kai): the others already made their move this tick, sweep against where they are now
+			for (uint32 k = 0; k < batchCount; k++)
+			{
+				batch.VelocityX[k] = 0.0f;
+				batch.VelocityY[k] = 0.0f;
+			}
+
+			SweptAABBBatch(x, y, halfX, halfY, motionX, motionY, &batch);
+
+			for (uint32 k = 0; k < batchCount; k++)
+			{
+				float toi, normalX, normalY;
+
+				if (batch.TimeOfImpact[k] == COLLISION_NO_IMPACT
+					|| !SweptAABBTimeOfImpact(x, y, halfX, halfY, motionX, motionY,
+											  batch.CenterX[k], batch.CenterY[k], batch.HalfX[k], batch.HalfY[k],
+											  &toi, &normalX, &normalY))
+				{
+					continue;
+				}
+
+				Collider *B = BPhase.Proxies[Candidates[first + start + k]].Owner;
+
+				if (!IsBlocking(A, B))
+				{
+					ReportSweepTrigger(A, B, first + start + k);
+
+					continue;
+				}
+
+				if (toi < hitTime || !hit)
+				{
+					hit = B;
+					hitTime = toi;
+					hitNormalX = normalX;
+					hitNormalY = normalY;
+				}
+			}
+		}
+
+		if (!hit)
+		{
+			x += motionX;
+			y += motionY;
+
+			break;
+		}
+
+		x += motionX * hitTime + hitNormalX * ContinuousSkin;
+		y += motionY * hitTime + hitNormalY * ContinuousSkin;
+
+		ApplySweepHit(A, hit, hitNormalX, hitNormalY);
+
+		// slide along the surface with whatever motion is left
+		motionX = hitNormalX != 0.0f ? 0.0f : motionX * (1.0f - hitTime);
+		motionY = hitNormalY != 0.0f ? 0.0f : motionY * (1.0f - hitTime);
+
+		if (motionX == 0.0f && motionY == 0.0f)
+		{
+			break;
+		}
+	}
+
+	A->pos->X = x - A->offset.X;
+	A->pos->Y = y - A->offset.Y;
+	Bodies.CenterX[index] = x;
+	Bodies.CenterY[index] = y;
+}
+
+file_internal void DetectContactsJob(void *data, uint32 begin, uint32 end, uint32 threadIndex)
+{
+	((PhysicsEngine *)data)->DetectContacts(begin, end, threadIndex);
+}
+
+//NOTE(kai): the detect pass ran before anything was resolved, an earlier contact in the serial pass may have
+//			 stopped A on this axis or moved it since. the gaps are measured again from where A is now and the
+//			 correction comes from those, the same way DetectSweptAABB works it out
+file_internal bool RefreshContact(Contact *contact)
+{
+	Collider *A = contact->A;
+	Collider *B = contact->B;
+
+	if ((contact->Axis == CONTACT_X && A->velocity.X == 0.0f) ||
+		(contact->Axis == CONTACT_Y && A->velocity.Y == 0.0f))
+	{
+		return false;
+	}
+
+	vec2f diffrence;
+	diffrence.X = (B->pos->X + B->offset.X) - (A->pos->X + A->offset.X);
+	diffrence.Y = (B->pos->Y + B->offset.Y) - (A->pos->Y + A->offset.Y);
+
+	vec2f gap;
+	gap.X = abs(diffrence.X) - (A->size.X / 2.0f + B->size.X / 2.0f);
+	gap.Y = abs(diffrence.Y) - (A->size.Y / 2.0f + B->size.Y / 2.0f);
+
+	vec2f motion = vec2f(abs(A->velocity.X - B->velocity.X), abs(A->velocity.Y - B->velocity.Y));
+
+	//NOTE(kai): an axis A doesn't move along has to overlap already, one it moves along can't be
+	//			 further off than this step's motion
+	if (A->velocity.X == 0.0f ? gap.X >= 0.0f : gap.X > motion.X)
+	{
+		return false;
+	}
+
+	if (A->velocity.Y == 0.0f ? gap.Y >= 0.0f : gap.Y > motion.Y)
+	{
+		return false;
+	}
+
+	if (contact->Axis == CONTACT_X)
+	{
+		contact->Positive = diffrence.X > 0;
+		contact->Correction.X = contact->Positive ? gap.X : -gap.X;
+	}
+	else if (contact->Axis == CONTACT_Y)
+	{
+		contact->Positive = diffrence.Y > 0;
+		contact->Correction.Y = contact->Positive ? gap.Y : -gap.Y;
+	}
+
+	if (contact->Touch != CONTACT_TOUCH_NONE)
+	{
+		if (contact->Normal.X != 0.0f)
+		{
+			contact->Penetration = -gap.X;
+			contact->Normal = diffrence.X > 0 ? vec2f(1, 0) : vec2f(-1, 0);
+		}
+		else
+		{
+			contact->Penetration = -gap.Y;
+			contact->Normal = diffrence.Y > 0 ? vec2f(0, 1) : vec2f(0, -1);
+		}
+
+		if (contact->Penetration <= 0.0f)
+		{
+			contact->Touch = CONTACT_TOUCH_NONE;
+		}
+	}
+
+	return true;
+}
+
+void PhysicsEngine::DetectContacts(uint32 begin, uint32 end, uint32 threadIndex)
+{
+	CollisionBatch batch;
+	std::vector<Contact> *contacts = &ThreadContacts[threadIndex];
+
+	for (uint32 i = begin; i < end; i++)
+	{
+		//NOTE(kai): the swept test never reports a hit for a collider that isn't moving
+		if (Bodies.VelocityX[i] == 0.0f && Bodies.VelocityY[i] == 0.0f)
+		{
+			continue;
+		}
+
+		if (Sweeping[i])
+		{
+			continue;
+		}
+
+		Collider *collider1 = BPhase.Proxies[i].Owner;
+
+		for (uint32 first = CandidateStart[i]; first < CandidateStart[i + 1]; first += COLLISION_BATCH_SIZE)
+		{
+			uint32 count = CandidateStart[i + 1] - first;
+
+			if (count > COLLISION_BATCH_SIZE)
+			{
+				count = COLLISION_BATCH_SIZE;
+			}
+
+			GatherBatch(&batch, &Bodies, &Candidates[first], count);
+
+			uint32 hits = SweptAABBBatch(Bodies.CenterX[i], Bodies.CenterY[i], Bodies.HalfX[i], Bodies.HalfY[i],
+										 Bodies.VelocityX[i], Bodies.VelocityY[i], &batch);
+
+			for (uint32 j = 0; j < count; j++)
+			{
+				Contact contact;
+
+				if ((hits & (1u << j)) && DetectSweptAABB(collider1, BPhase.Proxies[Candidates[first + j]].Owner, &contact))
+				{
+					contact.Order = first + j;
+					contacts->push_back(contact);
+				}
+			}
+		}
+	}
+}
+
+void PhysicsEngine::Update(float delta)
+{
+	Stats = {};
+
+	//NOTE(kai): the world runs at its own rate, a game update can take no steps or several
+	Accumulator += delta;
+
+	if (Accumulator > FixedDelta * MaxSteps)
+	{
+		Accumulator = FixedDelta * MaxSteps;
+	}
+
+	uint32 steps = 0;
+
+	while (Accumulator >= FixedDelta)
+	{
+		for (uint32 i = 0; i < Substeps; i++)
+		{
+			Step(FixedDelta / Substeps, steps == 0);
+			steps++;
+		}
+
+		Accumulator -= FixedDelta;
+	}
+
+	Alpha = Accumulator / FixedDelta;
+
+	if (!steps)
+	{
+		return;
+	}
+
+	std::vector<GameComponent *> *colliders = Scene->GetAllComponents("COLLIDER");
+
+	if (colliders)
+	{
+		for (uint32 i = 0; i < colliders->size(); i++)
+		{
+			((Collider*)(*colliders)[i])->force = vec2f();
+		}
+	}
+}
+
+void PhysicsEngine::Integrate(Collider *collider, float h)
+{
+	vec2f acceleration = vec2f(collider->force.X / collider->mass, collider->force.Y / collider->mass);
+
+	if (collider->useGravity)
+	{
+		//NOTE(kai): standing on the ground stops the fall, the same rule the gravity components had
+		if (collider->jump && collider->linearVelocity.Y <= 0.0f)
+		{
+			collider->linearVelocity.Y = 0.0f;
+		}
+		else
+		{
+			acceleration.X += Gravity.X * collider->gravityScale;
+			acceleration.Y += Gravity.Y * collider->gravityScale;
+		}
+	}
+
+	collider->linearVelocity.X += acceleration.X * h;
+	collider->linearVelocity.Y += acceleration.Y * h;
+
+	//NOTE(kai): velocity stays what the collision code expects, the distance moved this step
+	collider->velocity = vec2f(collider->linearVelocity.X * h, collider->linearVelocity.Y * h);
+	collider->pos->X += collider->velocity.X;
+	collider->pos->Y += collider->velocity.Y;
+}
+
+void PhysicsEngine::Step(float h, bool firstStep)
+{
+	std::vector<GameComponent *> *colliders = Scene->GetAllComponents("COLLIDER");
+
+	if (colliders)
+	{
+		//NOTE(kai): the pairs are kept for the whole update, so the game sees every hit from every step
+		if (firstStep)
+		{
+			for (uint32 i = 0; i < Colliders.size(); i++)
+			{
+				CollidedNamesPool.Free(Colliders[i]);
+			}
+
+			Colliders.clear();
+		}
+
+		BPhase.Clear();
+		Bodies.Clear();
+		Sweeping.clear();
+		PathStart.clear();
+
+		for (uint32 i = 0; i < colliders->size(); i++)
+		{
+			Collider *collider = (Collider*)(*colliders)[i];
+
+			if (Scene->CurrentRoot)
+			{
+				if (collider->Owner->CurrentRoot != Scene->CurrentRoot->Name)
+				{
+					collider->hasPathStart = false;
+					continue;
+				}
+			}
+
+			if (!collider->Owner->Enabled)
+			{
+				collider->hasPathStart = false;
+				continue;
+			}
+
+			//collider->velocity = (*(collider->pos) - *(collider->OldPos)).XY();
+
+			//NOTE(kai): colliders the game moves itself only moved once this update, so only the first
+			//			 step sees their velocity. the dynamic ones are moved by every step
+			vec2f start = collider->hasPathStart ? collider->pathStart : collider->pos->XY();
+			bool hasStart = collider->hasPathStart;
+
+			if (collider->dynamic)
+			{
+				start = collider->pos->XY();
+				hasStart = true;
+
+				Integrate(collider, h);
+			}
+
+			bool resting = UpdateSleep(collider);
+			bool moving = !resting && (collider->dynamic || firstStep);
+
+			if (collider->sleeping)
+			{
+				Stats.Sleeping++;
+			}
+
+			//NOTE(kai): nothing touches a sleeping collider without waking it, so its contact flags still hold
+			if (!collider->sleeping)
+			{
+				collider->rigth = false;
+				collider->left = false;
+				collider->down = false;
+				collider->up = false;
+			}
+
+			collider->detected = false;
+
+			bool sweeping = moving && hasStart && NeedsSweep(collider, start);
+
+			BPhase.AddProxy(MakeProxy(collider, sweeping, resting, start));
+			Sweeping.push_back(sweeping);
+			PathStart.push_back(start);
+			Bodies.Add(collider->pos->X + collider->offset.X, collider->pos->Y + collider->offset.Y,
+					   collider->size.X / 2.0f, collider->size.Y / 2.0f,
+					   moving ? collider->velocity.X : 0.0f, moving ? collider->velocity.Y : 0.0f);
+		}
+
+		uint32 count = (uint32)BPhase.Proxies.size();
+
+		BPhase.FindPairs(&Pairs);
+		AddTilePairs();
+		BuildCandidates();
+
+		Stats.Steps++;
+		Stats.Proxies += (uint32)BPhase.Proxies.size();
+		Stats.BroadphasePairs += (uint32)Pairs.size();
+
+		for (uint32 i = 0; i < Sweeping.size(); i++)
+		{
+			if (Sweeping[i])
+			{
+				SweepContinuous(i);
+				Stats.Sweeps++;
+			}
+		}
+
+		for (uint32 i = 0; i < Scene->Jobs.GetThreadCount(); i++)
+		{
+			ThreadContacts[i].clear();
+		}
+
+		Scene->Jobs.ParallelFor((uint32)BPhase.Proxies.size(), 16, DetectContactsJob, this);
+
+		//NOTE(kai): merge in candidate order so the result doesn't depend on how the work was split
+		Contacts.clear();
+
+		for (uint32 i = 0; i < Scene->Jobs.GetThreadCount(); i++)
+		{
+			Contacts.insert(Contacts.end(), ThreadContacts[i].begin(), ThreadContacts[i].end());
+		}
+
+		std::sort(Contacts.begin(), Contacts.end(), [](const Contact &a, const Contact &b)
+		{
+			return a.Order < b.Order;
+		});
+
+		Stats.ContactsFound += (uint32)Contacts.size();
+
+		//NOTE(kai): resolving moves colliders, so each contact is measured again against the
+		//			 positions and velocities the earlier ones left behind before it's applied
+		for (uint32 i = 0; i < Contacts.size(); i++)
+		{
+			if (RefreshContact(&Contacts[i]))
+			{
+				ResolveContact(&Contacts[i]);
+
+				Stats.ContactsResolved++;
+				WakeCollider(Contacts[i].B);
+				AddCollidedPair(Contacts[i].A, Contacts[i].B);
+			}
+		}
+
+		//NOTE(kai): a hit zeroes the motion into the surface, the integrated velocity has to stop too.
+		//			 wherever the collider ends up is where its next path starts
+		for (uint32 i = 0; i < count; i++)
+		{
+			Collider *collider = BPhase.Proxies[i].Owner;
+
+			collider->pathStart = collider->pos->XY();
+			collider->hasPathStart = true;
+
+			if (collider->dynamic)
+			{
+				if (collider->velocity.X == 0.0f)
+				{
+					collider->linearVelocity.X = 0.0f;
+				}
+
+				if (collider->velocity.Y == 0.0f)
+				{
+					collider->linearVelocity.Y = 0.0f;
+				}
+			}
+		}
+	
+		BuildQueryIndex();
+	}
+	else
+	{
+		QueryIndex.Clear();
+		QueryIndex.PrepareQueries();
+	}
+}
+
+void PhysicsEngine::AddTileCollider(TileCollider *tiles)
+{
+	TileColliders.push_back(tiles);
+}
+
+void PhysicsEngine::RemoveTileCollider(TileCollider *tiles)
+{
+	std::vector<TileCollider *>::iterator it = std::find(TileColliders.begin(), TileColliders.end(), tiles);
+
+	if (it != TileColliders.end())
+	{
+		TileColliders.erase(it);
+	}
+
+	for (uint32 i = 0; i < tiles->Colliders->size(); i++)
+	{
+		RemoveCollider(&(*tiles->Colliders)[i]);
+	}
+}
+
+void PhysicsEngine::FindTileColliders(float minX, float minY, float maxX, float maxY, std::vector<Collider *> *result)
+{
+	for (uint32 i = 0; i < TileColliders.size(); i++)
+	{
+		TileCollider *tiles = TileColliders[i];
+
+		TileRects.clear();
+		tiles->FindRects(minX, minY, maxX, maxY, &TileRects);
+
+		for (uint32 j = 0; j < TileRects.size(); j++)
+		{
+			result->push_back(&(*tiles->Colliders)[TileRects[j]]);
+		}
+	}
+}
+
+void PhysicsEngine::AddTilePairs()
+{
+	uint32 count = (uint32)BPhase.Proxies.size();
+
+	ActiveTileColliders.clear();
+
+	for (uint32 i = 0; i < TileColliders.size(); i++)
+	{
+		TileCollider *tiles = TileColliders[i];
+
+		if (Scene->CurrentRoot && tiles->Owner->CurrentRoot != Scene->CurrentRoot->Name)
+		{
+			continue;
+		}
+
+		if (!tiles->Owner->Enabled)
+		{
+			continue;
+		}
+
+		//NOTE(kai): the rects go after the sorted proxies so the sweep and the narrowphase can index them
+		tiles->ProxyBase = (uint32)BPhase.Proxies.size();
+		ActiveTileColliders.push_back(tiles);
+
+		for (uint32 j = 0; j < tiles->Colliders->size(); j++)
+		{
+			Collider *collider = &(*tiles->Colliders)[j];
+
+			BPhase.AddProxy(MakeProxy(collider, false, true, collider->pos->XY()));
+			Sweeping.push_back(false);
+			PathStart.push_back(collider->pos->XY());
+			Bodies.Add(collider->pos->X, collider->pos->Y, collider->size.X / 2.0f, collider->size.Y / 2.0f, 0.0f, 0.0f);
+		}
+	}
+
+	if (ActiveTileColliders.empty())
+	{
+		return;
+	}
+
+	//NOTE(kai): only the cells under a moving collider are looked at, the tiles never pair with each other
+	for (uint32 i = 0; i < count; i++)
+	{
+		BroadphaseProxy *proxy = &BPhase.Proxies[i];
+
+		if (proxy->Resting)
+		{
+			continue;
+		}
+
+		for (uint32 j = 0; j < ActiveTileColliders.size(); j++)
+		{
+			TileCollider *tiles = ActiveTileColliders[j];
+
+			TileRects.clear();
+			tiles->FindRects(proxy->MinX, proxy->MinY, proxy->MaxX, proxy->MaxY, &TileRects);
+
+			for (uint32 k = 0; k < TileRects.size(); k++)
+			{
+				uint32 index = tiles->ProxyBase + TileRects[k];
+
+				if (CanCollide(proxy, &BPhase.Proxies[index]))
+				{
+					Pairs.push_back(BroadphasePair{ i, index });
+				}
+			}
+		}
+	}
+}
+
+void PhysicsEngine::BuildQueryIndex()
+{
+	QueryIndex.Clear();
+
+	for (uint32 i = 0; i < BPhase.Proxies.size(); i++)
+	{
+		Collider *collider = BPhase.Proxies[i].Owner;
+
+		float x = collider->pos->X + collider->offset.X;
+		float y = collider->pos->Y + collider->offset.Y;
+
+		BroadphaseProxy proxy;
+		proxy.MinX = x - collider->size.X / 2.0f;
+		proxy.MinY = y - collider->size.Y / 2.0f;
+		proxy.MaxX = x + collider->size.X / 2.0f;
+		proxy.MaxY = y + collider->size.Y / 2.0f;
+		proxy.LayerBits = collider->layerBits;
+		proxy.MaskBits = BPhase.Proxies[i].MaskBits;
+		proxy.Resting = BPhase.Proxies[i].Resting;
+		proxy.Owner = collider;
+
+		QueryIndex.AddProxy(proxy);
+	}
+
+	QueryIndex.PrepareQueries();
+}
+
+void PhysicsEngine::RemoveCollider(Collider *collider)
+{
+	//NOTE(kai): the query index lives until the next update, so it can't keep pointing at a removed collider
+	for (uint32 i = 0; i < QueryIndex.Proxies.size(); i++)
+	{
+		if (QueryIndex.Proxies[i].Owner == collider)
+		{
+			QueryIndex.Proxies[i].Owner = NULL;
+		}
+	}
+}
+
+file_internal bool RayVsBox(float originX, float originY, float dirX, float dirY, float maxDistance,
+							BroadphaseProxy *box, float *distance, float *normalX, float *normalY)
+{
+	float enter = 0.0f;
+	float exit = maxDistance;
+	float nX = 0.0f;
+	float nY = 0.0f;
+
+	if (dirX == 0.0f)
+	{
+		if (originX < box->MinX || originX > box->MaxX)
+		{
+			return false;
+		}
+	}
+	else
+	{
+		float t1 = (box->MinX - originX) / dirX;
+		float t2 = (box->MaxX - originX) / dirX;
+		float n = -1.0f;
+
+		if (t1 > t2)
+		{
+			std::swap(t1, t2);
+			n = 1.0f;
+		}
+
+		if (t1 > enter)
+		{
+			enter = t1;
+			nX = n;
+			nY = 0.0f;
+		}
+
+		exit = min(exit, t2);
+	}
+
+	if (dirY == 0.0f)
+	{
+		if (originY < box->MinY || originY > box->MaxY)
+		{
+			return false;
+		}
+	}
+	else
+	{
+		float t1 = (box->MinY - originY) / dirY;
+		float t2 = (box->MaxY - originY) / dirY;
+		float n = -1.0f;
+
+		if (t1 > t2)
+		{
+			std::swap(t1, t2);
+			n = 1.0f;
+		}
+
+		if (t1 > enter)
+		{
+			enter = t1;
+			nX = 0.0f;
+			nY = n;
+		}
+
+		exit = min(exit, t2);
+	}
+
+	if (enter > exit)
+	{
+		return false;
+	}
+
+	//NOTE(kai): a ray starting inside a box hits it right away with no normal
+	*distance = enter;
+	*normalX = nX;
+	*normalY = nY;
+
+	return true;
+}
+
+bool PhysicsEngine::RaycastIndex(RaycastQuery *query, RaycastHit *hit, uint32 threadIndex)
+{
+	hit->Hit = NULL;
+	hit->Point = query->Origin;
+	hit->Normal = vec2f();
+	hit->Distance = query->MaxDistance;
+
+	float length = sqrtf(query->Direction.X * query->Direction.X + query->Direction.Y * query->Direction.Y);
+
+	if (length == 0.0f)
+	{
+		return false;
+	}
+
+	float originX = query->Origin.X;
+	float originY = query->Origin.Y;
+	float dirX = query->Direction.X / length;
+	float dirY = query->Direction.Y / length;
+	float endX = originX + dirX * query->MaxDistance;
+	float endY = originY + dirY * query->MaxDistance;
+
+	std::vector<uint32> *candidates = &QueryCandidates[threadIndex];
+	candidates->clear();
+
+	QueryIndex.Query(min(originX, endX), min(originY, endY), max(originX, endX), max(originY, endY),
+					 query->LayerMask, candidates);
+
+	for (uint32 i = 0; i < candidates->size(); i++)
+	{
+		BroadphaseProxy *proxy = &QueryIndex.Proxies[(*candidates)[i]];
+		float distance, normalX, normalY;
+
+		if (proxy->Owner == query->Ignore)
+		{
+			continue;
+		}
+
+		if (!RayVsBox(originX, originY, dirX, dirY, hit->Distance, proxy, &distance, &normalX, &normalY))
+		{
+			continue;
+		}
+
+		if (!hit->Hit || distance < hit->Distance)
+		{
+			hit->Hit = proxy->Owner;
+			hit->Distance = distance;
+			hit->Normal = vec2f(normalX, normalY);
+		}
+	}
+
+	if (hit->Hit)
+	{
+		hit->Point = vec2f(originX + dirX * hit->Distance, originY + dirY * hit->Distance);
+	}
+
+	return hit->Hit != NULL;
 }
 
-void PhysicsEngine::Update()
+Collider* PhysicsEngine::NearestIndex(NearestQuery *query, float *distance, uint32 threadIndex)
 {
-	std::vector<GameComponent *> *colliders = Scene->GetAllComponents("COLLIDER");
+	std::vector<uint32> *candidates = &QueryCandidates[threadIndex];
+	candidates->clear();
 
-	if (colliders)
+	QueryIndex.Query(query->Point.X - query->MaxDistance, query->Point.Y - query->MaxDistance,
+					 query->Point.X + query->MaxDistance, query->Point.Y + query->MaxDistance,
+					 query->LayerMask, candidates);
+
+	Collider *nearest = NULL;
+	float best = query->MaxDistance * query->MaxDistance;
+
+	for (uint32 i = 0; i < candidates->size(); i++)
 	{
-		for (uint32 i = 0; i < Colliders.size(); i++)
+		BroadphaseProxy *proxy = &QueryIndex.Proxies[(*candidates)[i]];
+
+		if (proxy->Owner == query->Ignore)
 		{
-			CollidedNamesPool.Free(Colliders[i]);
+			continue;
 		}
 
-		Colliders.clear();
+		float dx = (proxy->MinX + proxy->MaxX) / 2.0f - query->Point.X;
+		float dy = (proxy->MinY + proxy->MaxY) / 2.0f - query->Point.Y;
+		float distanceSq = dx * dx + dy * dy;
 
-		for (uint32 i = 0; i < colliders->size(); i++)
+		if (distanceSq <= best)
 		{
-			Collider *collider = (Collider*)(*colliders)[i];
+			nearest = proxy->Owner;
+			best = distanceSq;
+		}
+	}
 
-			if (Scene->CurrentRoot)
-			{
-				if (collider->Owner->CurrentRoot != Scene->CurrentRoot->Name)
-				{
-					continue;
-				}
-			}
+	if (distance)
+	{
+		*distance = sqrtf(best);
+	}
 
-			if (!collider->Owner->Enabled)
-			{
-				continue;
-			}
+	return nearest;
+}
 
-			//collider->velocity = (*(collider->pos) - *(collider->OldPos)).XY();
+bool PhysicsEngine::Raycast(vec2f origin, vec2f direction, float maxDistance, RaycastHit *hit,
+							uint32 layerMask, Collider *ignore)
+{
+	RaycastQuery query = { origin, direction, maxDistance, layerMask, ignore };
 
-			collider->rigth = false;
-			collider->left = false;
-			collider->down = false;
-			collider->up = false;
-		}
+	return RaycastIndex(&query, hit, 0);
+}
 
-		for (uint32 i = 0; i < colliders->size(); i++)
-		{
-			for (uint32 j = 0; j < colliders->size(); j++)
-			{
-				if (i == j)
-				{
-					continue;
-				}
+uint32 PhysicsEngine::OverlapBox(vec2f center, vec2f halfSize, std::vector<Collider *> *result, uint32 layerMask)
+{
+	std::vector<uint32> *candidates = &QueryCandidates[0];
+	candidates->clear();
 
-				Collider *collider1 = (Collider*)(*colliders)[i];
-				Collider *collider2 = (Collider*)(*colliders)[j];
+	QueryIndex.Query(center.X - halfSize.X, center.Y - halfSize.Y, center.X + halfSize.X, center.Y + halfSize.Y,
+					 layerMask, candidates);
 
-				if (Scene->CurrentRoot)
-				{
-					if (collider1->Owner->CurrentRoot != Scene->CurrentRoot->Name
-						|| collider2->Owner->CurrentRoot != Scene->CurrentRoot->Name)
-					{
-						continue;
-					}
-				}				
+	for (uint32 i = 0; i < candidates->size(); i++)
+	{
+		result->push_back(QueryIndex.Proxies[(*candidates)[i]].Owner);
+	}
 
-				if (!collider1->Owner->Enabled || !collider2->Owner->Enabled)
-				{
-					continue;
-				}
+	return (uint32)candidates->size();
+}
 
-				CollidedPair CollidedName = { collider1->Owner->Name, collider2->Owner->Name };
+uint32 PhysicsEngine::OverlapCircle(vec2f center, float radius, std::vector<Collider *> *result, uint32 layerMask)
+{
+	std::vector<uint32> *candidates = &QueryCandidates[0];
+	candidates->clear();
 
-				if (SweptAABBvsAABB(collider1, collider2, Scene->Delta))
-				{
-					CollidedPair *cp = (CollidedPair *)CollidedNamesPool.Alloc();
-					if (cp)
-					{
-						*cp = CollidedName;
-						Colliders.push_back(cp);
-					}
-				}
-			}
+	QueryIndex.Query(center.X - radius, center.Y - radius, center.X + radius, center.Y + radius,
+					 layerMask, candidates);
+
+	uint32 count = 0;
+
+	for (uint32 i = 0; i < candidates->size(); i++)
+	{
+		BroadphaseProxy *proxy = &QueryIndex.Proxies[(*candidates)[i]];
+
+		//NOTE(kai): distance from the center to the closest point of the box
+		float dx = center.X - max(proxy->MinX, min(center.X, proxy->MaxX));
+		float dy = center.Y - max(proxy->MinY, min(center.Y, proxy->MaxY));
+
+		if (dx * dx + dy * dy <= radius * radius)
+		{
+			result->push_back(proxy->Owner);
+			count++;
 		}
 	}
+
+	return count;
+}
+
+Collider* PhysicsEngine::Nearest(vec2f point, float maxDistance, uint32 layerMask, Collider *ignore, float *distance)
+{
+	NearestQuery query = { point, maxDistance, layerMask, ignore };
+
+	return NearestIndex(&query, distance, 0);
+}
+
+void PhysicsEngine::RunRaycasts(RaycastQuery *queries, RaycastHit *hits, uint32 begin, uint32 end, uint32 threadIndex)
+{
+	for (uint32 i = begin; i < end; i++)
+	{
+		RaycastIndex(&queries[i], &hits[i], threadIndex);
+	}
+}
+
+void PhysicsEngine::RunNearest(NearestQuery *queries, Collider **results, uint32 begin, uint32 end, uint32 threadIndex)
+{
+	for (uint32 i = begin; i < end; i++)
+	{
+		results[i] = NearestIndex(&queries[i], NULL, threadIndex);
+	}
+}
+
+struct RaycastJob
+{
+	PhysicsEngine *Engine;
+	RaycastQuery *Queries;
+	RaycastHit *Hits;
+};
+
+struct NearestJob
+{
+	PhysicsEngine *Engine;
+	NearestQuery *Queries;
+	Collider **Results;
+};
+
+file_internal void RaycastJobCallback(void *data, uint32 begin, uint32 end, uint32 threadIndex)
+{
+	RaycastJob *job = (RaycastJob *)data;
+	job->Engine->RunRaycasts(job->Queries, job->Hits, begin, end, threadIndex);
+}
+
+file_internal void NearestJobCallback(void *data, uint32 begin, uint32 end, uint32 threadIndex)
+{
+	NearestJob *job = (NearestJob *)data;
+	job->Engine->RunNearest(job->Queries, job->Results, begin, end, threadIndex);
+}
+
+void PhysicsEngine::RaycastBatch(RaycastQuery *queries, RaycastHit *hits, uint32 count)
+{
+	RaycastJob job = { this, queries, hits };
+
+	Scene->Jobs.ParallelFor(count, 32, RaycastJobCallback, &job);
+}
+
+void PhysicsEngine::NearestBatch(NearestQuery *queries, Collider **results, uint32 count)
+{
+	NearestJob job = { this, queries, results };
+
+	Scene->Jobs.ParallelFor(count, 32, NearestJobCallback, &job);
 }
 
-bool PhysicsEngine::SweptAABBvsAABB(Collider *A, Collider *B, float delta)
+bool PhysicsEngine::DetectSweptAABB(Collider *A, Collider *B, Contact *contact)
 {
 	vec2f d0, d1;
 	vec2f VAB;
 	vec2f u0, u1;
 	float t0, t1;
-	int count = 0;
 	int flag = 0;
 	VAB.X = (A->velocity.X - (B->velocity.X));
 	VAB.Y = A->velocity.Y - (B->velocity.Y);
 
-	bool temp = false;
-	vec2f a_extent, b_extent;
-	vec2f amin, amax, bmin, bmax;
 	vec2f diffrence;
 
-	a_extent.X = A->pos->X +A->offset.X+ (A->size.X) / 2.0f;
-	b_extent.X = B->pos->X + B->offset.X + B->size.X / 2.0f;
-
-	//diffrence.X = (b_extent.X - a_extent.X);
 	diffrence.X = (B->pos->X + B->offset.X) - (A->pos->X + A->offset.X);
-
-	a_extent.Y = A->pos->Y + A->offset.Y + (A->size.Y) / 2.0f;
-	b_extent.Y = B->pos->Y + B->offset.Y + B->size.Y / 2.0f;
-
-	//diffrence.Y = (b_extent.Y - a_extent.Y);
 	diffrence.Y = B->pos->Y + B->offset.Y - (A->pos->Y + A->offset.Y);
 
-
-	//d0.X = B->collider.pos.X - (A->collider.pos.X + A->collider.size.X);
-	//d1.X = B->collider.pos.X + B->collider.size.X - A->collider.pos.X;
-
 	d0.X = abs(diffrence.X) - (A->size.X / 2.0f + B->size.X / 2.0f);
 	d0.Y = abs(diffrence.Y) - (A->size.Y / 2.0f + B->size.Y / 2.0f);
 
@@ -130,57 +1250,29 @@ bool PhysicsEngine::SweptAABBvsAABB(Collider *A, Collider *B, float delta)
 	float x_overlap = ((A->size.X) / 2.0f + (B->size.X / 2.0f)) - abs(diffrence.X);
 	float y_overlap = (A->size.Y / 2.0f + (B->size.Y / 2.0f)) - abs(diffrence.Y);
 
-
-
+	contact->A = A;
+	contact->B = B;
+	contact->Axis = CONTACT_NONE;
+	contact->Positive = false;
+	contact->Correction = vec2f();
+	contact->Touch = CONTACT_TOUCH_NONE;
+	contact->Normal = vec2f();
+	contact->Penetration = 0;
 
 	if (abs(A->velocity.X) > 0 && A->velocity.Y == 0)
 	{
-
 		if (y_overlap > 0)
 		{
-			/*if (A->velocity.X <= -10.0f){
-
-			if (A->pos->X < B->pos->X){
-			A->pos->X += A->velocity.X;
-			if (A->pos->X > B->pos->X)
-			{
-			diffrence.X = B->pos->X - A->pos->X;
-			d0.X = abs(diffrence.X) - (A->size.X / 2.0f + B->size.X / 2.0f);
-			d1.X = abs(diffrence.X) + (A->size.X / 2.0f + B->size.X / 2.0f);
-
-			u0.X = abs(d0.X / abs(VAB.X));
-			u1.X = d1.X / abs(VAB.X);
-			u0.Y = 0;
-			u1.Y = 1.0f;
-			}
-			else {
-			A->pos->X -= A->velocity.X;
-
-			}
-			}*/
-			//}
-
 			if (d0.X < 0) {
+				u0.X = 0;
 				u1.X = 1;
 				u0.Y = 0;
 				u1.Y = 1.0f;
-				A->penetration = x_overlap;
-				B->penetration = x_overlap;
-
-				if (diffrence.X > 0) {
-
-					A->normal = vec2f(1, 0);
-					B->normal = vec2f(-1, 0);
-
-				}
-
-				else {
-					A->normal = vec2f(-1, 0);
-					B->normal = vec2f(1, 0);
 
-				}
+				contact->Touch = CONTACT_TOUCH_BOTH;
+				contact->Penetration = x_overlap;
+				contact->Normal = diffrence.X > 0 ? vec2f(1, 0) : vec2f(-1, 0);
 			}
-
 			else
 			{
 				// compute eariler collsion time in x 
@@ -190,24 +1282,14 @@ bool PhysicsEngine::SweptAABBvsAABB(Collider *A, Collider *B, float delta)
 				u0.Y = 0;
 				u1.Y = 1.0f;
 			}
-
 		}
-		else {
-
-			//std::cout << "Noo  collision " << std::endl;
-			/*B->normal = vec2f(0, 0);
-			A->normal = vec2f(0, 0);*/
-			A->detected = 0;
-			B->detected = 0;
+		else
+		{
 			return false;
 		}
-
-
 	}
-
-
-	else if (A->velocity.X == 0 && (abs(A->velocity.Y) > 0)) {
-
+	else if (A->velocity.X == 0 && (abs(A->velocity.Y) > 0))
+	{
 		if (x_overlap > 0)
 		{
 			if (d0.Y < 0) {
@@ -215,13 +1297,10 @@ bool PhysicsEngine::SweptAABBvsAABB(Collider *A, Collider *B, float delta)
 				u1.X = 1;
 				u0.Y = 0;
 				u1.Y = 1.0f;
-				A->penetration = y_overlap;
-				if (diffrence.Y>0) {
-					A->normal = vec2f(0, 1);
-				}
-				else {
-					A->normal = vec2f(0, -1);
-				}
+
+				contact->Touch = CONTACT_TOUCH_A;
+				contact->Penetration = y_overlap;
+				contact->Normal = diffrence.Y > 0 ? vec2f(0, 1) : vec2f(0, -1);
 			}
 			else
 			{
@@ -230,220 +1309,174 @@ bool PhysicsEngine::SweptAABBvsAABB(Collider *A, Collider *B, float delta)
 
 				u0.X = 0;
 				u1.X = 1.0f;
-				count = 2;
 			}
 		}
-		else {
-			//	std::cout << "Noo  collision " << std::endl;
-			/*	B->normal = vec2f(0, 0);
-			A->normal = vec2f(0, 0);*/
-			A->detected = 0;
-			B->detected = 0;
-
+		else
+		{
 			return false;
 		}
 	}
-
-
 	else if (abs(A->velocity.Y)> 0 && abs(A->velocity.X) > 0)
 	{
-
-		/*if (d0.X < 0 && d0.Y < 0) {
-		u0.X = 0;
-		u1.X = 1;
-		u0.Y = 0;
-
-		u1.Y = 1.0f;
-		}
-		else
-		{*/
 		// no checking here for the x , y overlaps cause we move in both directions 
 		u0.X = abs(d0.X) / abs(VAB.X);
 		u1.X = abs(d1.X) / abs(VAB.X);
 
 		u0.Y = (d0.Y) / abs(VAB.Y);
 		u1.Y = (d1.Y) / abs(VAB.Y);
-
-		count = 4;
-
-		/*}*/
-
 	}
-
 	//Standing away / sticking on one of the sides 
-
-	else if (A->velocity.X == 0 && A->velocity.Y == 0)
+	else
 	{
-
-		/*if (d0.X < 0 && d0.Y < 0) {
-		if (!A->ground &&!B->ground &&!A->wall &&!B->wall){
-		u0.X = 0;
-		u1.X = 1;
-		u0.Y = 0;
-		u1.Y = 1.0f;
-		}
-		}
-		else
-		{*/
-		//std::cout << "Noo  collision " << std::endl;
-		/*B->normal = vec2f(0, 0);
-		A->normal = vec2f(0, 0);*/
-		A->detected = 0;
-		B->detected = 0;
-
-		count = 1;
-
 		return false;
 	}
-	//	}
-
 
 	// **************************end of conditions start the real swept test to detect collision or Not ***********************
 
 	t0 = max(u0.X, u0.Y);
 	t1 = min(u1.X, u1.Y);
 
-	//std::cout << "T0   "<<t0<<"   T1   " <<t1<< std::endl;
-
-	if (t0 <= t1 && t0 >= 0 && t0 <= 1) {
-
+	if (!(t0 <= t1 && t0 >= 0 && t0 <= 1))
+	{
+		return false;
+	}
 
-		if (A->trigger == 1 || B->trigger == 1)
+	if (A->trigger == 1 || B->trigger == 1)
+	{
+		if (!A->ground && !A->wall && !B->ground && !B->wall)
 		{
-			//	std::cout << "Trigger collision " << std::endl;
-			if (!A->ground && !A->wall && !B->ground && !B->wall)
-			{
-				A->detected = true;
-				B->detected = true;
-
-				return true;
-			}
+			return true;
+		}
+	}
 
+	if (u0.X == u0.Y){
+		if (abs(A->velocity.X)> 0){
+			flag = 1;
 		}
-		//std::cout << "collision " << std::endl;
-		if (u0.X == u0.Y){
-			if (abs(A->velocity.X)> 0){
-				flag = 1;
-			}
-			else if (abs(A->velocity.Y) > 0){
-				flag = 2;
-			}
+		else if (abs(A->velocity.Y) > 0){
+			flag = 2;
 		}
-		if (u0.X > u0.Y || flag == 1)
-		{
-
-			// left & rigth
-
-			if (A->wall)
-			{
-				A->jump = true;
-
-			}
-			else if (B->wall)
-			{
-
-				B->jump = true;
-
-			}
-			if (diffrence.X > 0)
-			{
-
-				// R A - L B 
-				/*	A->normal = vec2f(1, 0);
-				B->normal = vec2f(-1, 0);*/
-				std::cout << "Rigth " << std::endl;
-				//A->GlobalTransform.Position.X -= ((VAB.X)*delta - (d0.X));
-
-				A->pos->X -= ((VAB.X)*.016f - (d0.X));
-
-				A->rigth = 1;
-				B->left = 1;
-
-			}
-
-			else if (diffrence.X <= 0)
-			{
-				/*A->normal = vec2f(-1, 0);
-				B->normal = vec2f(1, 0);*/
-				//	std::cout << "left " << std::endl;
-				//A->GlobalTransform.Position.X += (abs(VAB.X)*delta - (d0.X));
-
-				A->pos->X += (abs(VAB.X)*.016f - (d0.X));
-
-				A->left = 1;
-				B->rigth = 1;
-
-			}
+	}
 
-			//**********************importannnt
-			A->velocity.X = 0.0f;
-			//	B->velocity.X = 0.0f;
+	//NOTE(kai): VAB is already this step's displacement, t0 * VAB on the contact axis is the gap d0 to B's face.
+	//			 moving A by d0 towards B puts it flush, whether it was short of B or already inside it
+	if (u0.X > u0.Y || flag == 1)
+	{
+		// left & rigth
+		contact->Axis = CONTACT_X;
+		contact->Positive = diffrence.X > 0;
 
+		if (contact->Positive)
+		{
+			// R A - L B 
+			contact->Correction.X = d0.X;
 		}
+		else
+		{
+			contact->Correction.X = -d0.X;
+		}
+	}
+	else if (u0.Y > u0.X || flag == 2)
+	{
+		contact->Axis = CONTACT_Y;
+		contact->Positive = diffrence.Y > 0;
 
-		else if (u0.Y>u0.X || flag == 2) {
-
-			if (diffrence.Y > 0)
-			{
-
-				/*A->normal = vec2f(0, 1);
-				B->normal = vec2f(0, -1);*/
-				//	std::cout << "up " << std::endl;
-
-				// up A down B
-				//A->GlobalTransform.Position.Y -= ((VAB.Y)*delta - (d0.Y));
-				A->pos->Y -= ((VAB.Y)*.016f - (d0.Y));
-
-				// no more jumping 
-				A->up = 1;
-				B->down = 1;
+		if (contact->Positive)
+		{
+			// up A down B
+			contact->Correction.Y = d0.Y;
+		}
+		else
+		{
+			// down A UP B
+			//fall
+			contact->Correction.Y = -d0.Y;
+		}
+	}
 
-			}
+	return true;
+}
 
-			else  if (diffrence.Y <= 0)
-			{
+void PhysicsEngine::ResolveContact(Contact *contact)
+{
+	Collider *A = contact->A;
+	Collider *B = contact->B;
 
-				/*	A->normal = vec2f(0, -1);
-				B->normal = vec2f(0, 1);*/
-				//	std::cout << "down " << std::endl;
+	if (contact->Touch != CONTACT_TOUCH_NONE)
+	{
+		A->penetration = contact->Penetration;
+		A->normal = contact->Normal;
 
-				// down A UP B
-				//fall
-				//A->GlobalTransform.Position.Y += abs(VAB.Y)*.016f;
-				A->pos->Y += abs(VAB.Y)*.016f;
+		if (contact->Touch == CONTACT_TOUCH_BOTH)
+		{
+			B->penetration = contact->Penetration;
+			B->normal = vec2f(-contact->Normal.X, -contact->Normal.Y);
+		}
+	}
 
-				A->down = 1;
-				B->up = 1;
+	if (contact->Axis == CONTACT_X)
+	{
+		if (A->wall)
+		{
+			A->jump = true;
+		}
+		else if (B->wall)
+		{
+			B->jump = true;
+		}
 
-			}
+		A->pos->X += contact->Correction.X;
 
-			//**********************importannnt
-			A->velocity.Y = 0;
-			//	B->velocity.Y = 0;
+		if (contact->Positive)
+		{
+			A->rigth = 1;
+			B->left = 1;
+		}
+		else
+		{
+			A->left = 1;
+			B->rigth = 1;
+		}
 
+		//**********************importannnt
+		A->velocity.X = 0.0f;
+	}
+	else if (contact->Axis == CONTACT_Y)
+	{
+		A->pos->Y += contact->Correction.Y;
 
+		if (contact->Positive)
+		{
+			// no more jumping 
+			A->up = 1;
+			B->down = 1;
+		}
+		else
+		{
+			A->down = 1;
+			B->up = 1;
 		}
 
-		A->detected = true;
-		B->detected = true;
-		return true;
-
+		//**********************importannnt
+		A->velocity.Y = 0;
 	}
 
-	else
-	{
-		A->detected = false;
-		B->detected = false;
-		/*A->normal = vec2f(0, 0);
-		B->normal = vec2f(0, 0);*/
+	A->detected = true;
+	B->detected = true;
+}
 
-		//std::cout << " disjoint  " << std::endl;
+bool PhysicsEngine::SweptAABBvsAABB(Collider *A, Collider *B)
+{
+	Contact contact;
 
-		return false;
+	if (DetectSweptAABB(A, B, &contact))
+	{
+		ResolveContact(&contact);
 
+		return true;
 	}
-	
 
+	return false;
 }
 bool PhysicsEngine::AABBvsAABB(Collider *A, Collider *B)
 {
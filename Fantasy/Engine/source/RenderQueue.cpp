@@ -0,0 +1,144 @@
+#include <RenderQueue.h>
+
+//NOTE(kai): flips the float's bits so comparing them as unsigned gives the same order as the floats
+file_internal uint32 SortableDepth(float depth)
+{
+	uint32 bits;
+	memcpy(&bits, &depth, sizeof(bits));
+
+	return (bits & 0x80000000) ? ~bits : (bits | 0x80000000);
+}
+
+uint64 MakeSortKey(uint8 layer, float depth, bool translucent, uint32 texture)
+{
+	uint64 key = 0;
+
+	key |= (uint64)layer << 56;
+	key |= (uint64)(SortableDepth(depth) >> 8) << 32;
+	key |= (uint64)(translucent ? 1 : 0) << 31;
+	key |= (uint64)(texture & 0x7FFFFFFF);
+
+	return key;
+}
+
+void ClearRenderQueue(RenderQueue *queue)
+{
+	queue->Items.clear();
+	queue->Keys.clear();
+}
+
+void PushRenderItem(RenderQueue *queue, Sprite *sprite, mat4f *model, uint8 layer, uint32 order)
+{
+	//NOTE(kai): lower z is further away and draws first
+	vec3f center = *model * sprite->Pos;
+	bool translucent = sprite->Color.W < 1.0f;
+
+	RenderKey key;
+	key.Key = MakeSortKey(layer, center.Z, translucent, sprite->Skin.MeshTexture.TextureHandle);
+	key.Item = (uint32)queue->Items.size();
+	key.Order = order;
+
+	queue->Keys.push_back(key);
+	queue->Items.push_back(RenderItem{ sprite, *model, layer });
+}
+
+void RadixSortKeys(RenderKey *keys, RenderKey *scratch, uint32 count)
+{
+	RenderKey *from = keys;
+	RenderKey *to = scratch;
+
+	for (uint32 shift = 0; shift < 64; shift += 8)
+	{
+		uint32 counts[256] = {};
+
+		for (uint32 i = 0; i < count; i++)
+		{
+			counts[(from[i].Key >> shift) & 0xFF]++;
+		}
+
+		//NOTE(kai): most bytes are the same for the whole frame (one layer, a handful of textures), nothing to move
+		if (counts[(from[0].Key >> shift) & 0xFF] == count)
+		{
+			continue;
+		}
+
+		uint32 offset = 0;
+
+		for (uint32 i = 0; i < 256; i++)
+		{
+			uint32 bucket = counts[i];
+			counts[i] = offset;
+			offset += bucket;
+		}
+
+		for (uint32 i = 0; i < count; i++)
+		{
+			to[counts[(from[i].Key >> shift) & 0xFF]++] = from[i];
+		}
+
+		RenderKey *swap = from;
+		from = to;
+		to = swap;
+	}
+
+	if (from != keys)
+	{
+		memcpy(keys, from, count * sizeof(RenderKey));
+	}
+}
+
+void SortRenderQueue(RenderQueue *queue)
+{
+	uint32 count = (uint32)queue->Keys.size();
+
+	if (count < 2)
+	{
+		return;
+	}
+
+	queue->Scratch.resize(count);
+
+	RadixSortKeys(queue->Keys.data(), queue->Scratch.data(), count);
+}
+
+void MergeRenderQueues(RenderQueue *queues, uint32 count, std::vector<RenderItem *> *merged)
+{
+	merged->clear();
+
+	uint32 total = 0;
+
+	for (uint32 i = 0; i < count; i++)
+	{
+		total += (uint32)queues[i].Keys.size();
+	}
+
+	merged->reserve(total);
+
+	std::vector<uint32> heads(count, 0);
+
+	//NOTE(kai): one queue per job thread, picking the smallest head each time beats a heap at these counts
+	for (uint32 n = 0; n < total; n++)
+	{
+		int32 best = -1;
+		RenderKey *bestKey = NULL;
+
+		for (uint32 i = 0; i < count; i++)
+		{
+			if (heads[i] >= queues[i].Keys.size())
+			{
+				continue;
+			}
+
+			RenderKey *key = &queues[i].Keys[heads[i]];
+
+			if (best < 0 || key->Key < bestKey->Key || (key->Key == bestKey->Key && key->Order < bestKey->Order))
+			{
+				best = (int32)i;
+				bestKey = key;
+			}
+		}
+
+		merged->push_back(&queues[best].Items[bestKey->Item]);
+		heads[best]++;
+	}
+}
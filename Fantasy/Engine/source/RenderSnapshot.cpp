@@ -0,0 +1,100 @@
+#include <RenderSnapshot.h>
+#include <GLState.h>
+
+void InitSnapshotBuffer(RenderSnapshotBuffer *buffer)
+{
+	for (uint32 i = 0; i < RENDER_SNAPSHOT_SLOTS; i++)
+	{
+		buffer->Slots[i].Frame = 0;
+		buffer->Slots[i].Debug = false;
+		buffer->Slots[i].Fence = 0;
+	}
+
+	buffer->Writing = 0;
+	buffer->Ready = 1;
+	buffer->Reading = 2;
+
+	buffer->Fresh = false;
+	buffer->Closed = false;
+
+	buffer->NextFrame = 0;
+
+	buffer->Stats = {};
+	buffer->DrawnFrames = 0;
+
+	SetDeferredDeleteFrame(0);
+}
+
+RenderSnapshot* BeginSnapshot(RenderSnapshotBuffer *buffer)
+{
+	RenderSnapshot *snapshot = &buffer->Slots[buffer->Writing];
+	snapshot->Frame = buffer->NextFrame;
+
+	return snapshot;
+}
+
+void PublishSnapshot(RenderSnapshotBuffer *buffer)
+{
+	{
+		std::lock_guard<std::mutex> lock(buffer->Lock);
+
+		uint32 ready = buffer->Ready;
+		buffer->Ready = buffer->Writing;
+		buffer->Writing = ready;
+		buffer->Fresh = true;
+	}
+
+	buffer->Published.notify_one();
+
+	//NOTE(kai): anything let go of from now on may still be in the snapshot that just went out, but not in the next one
+	buffer->NextFrame++;
+	SetDeferredDeleteFrame(buffer->NextFrame);
+}
+
+RenderSnapshot* AcquireSnapshot(RenderSnapshotBuffer *buffer, uint32 timeout)
+{
+	std::unique_lock<std::mutex> lock(buffer->Lock);
+
+	buffer->Published.wait_for(lock, std::chrono::milliseconds(timeout), [buffer]{ return buffer->Fresh || buffer->Closed; });
+
+	if (buffer->Closed || !buffer->Fresh)
+	{
+		return NULL;
+	}
+
+	uint32 ready = buffer->Ready;
+	buffer->Ready = buffer->Reading;
+	buffer->Reading = ready;
+	buffer->Fresh = false;
+
+	return &buffer->Slots[buffer->Reading];
+}
+
+void PublishRenderStats(RenderSnapshotBuffer *buffer, RenderStats *stats)
+{
+	std::lock_guard<std::mutex> lock(buffer->Lock);
+
+	buffer->Stats = *stats;
+	buffer->DrawnFrames++;
+}
+
+uint32 TakeRenderStats(RenderSnapshotBuffer *buffer, RenderStats *stats)
+{
+	std::lock_guard<std::mutex> lock(buffer->Lock);
+
+	uint32 frames = buffer->DrawnFrames;
+	*stats = buffer->Stats;
+	buffer->DrawnFrames = 0;
+
+	return frames;
+}
+
+void CloseSnapshotBuffer(RenderSnapshotBuffer *buffer)
+{
+	{
+		std::lock_guard<std::mutex> lock(buffer->Lock);
+		buffer->Closed = true;
+	}
+
+	buffer->Published.notify_all();
+}
\ No newline at end of file
@@ -1,170 +1,535 @@
 #include "RenderingEngine.h"
 #include "SceneManager.h"
 #include "SpriteRenderer.h"
+#include "TileMapRenderer.h"
+#include "ParallaxLayer.h"
 
 void RenderingEngine::Init()
 {
 	
 }
 
-void RenderingEngine::Render()
+//NOTE(kai): children follow a parent the cache can't see, so they are rebuilt every frame
+file_internal void UpdateRendererBounds(SpriteRenderer *renderer)
 {
-	std::vector<GameComponent *> *renderers = Scene->GetAllComponents("RENDERABLE");
-	
-	if (renderers)
+	Transform *transform = &renderer->Owner->ObjectTransform;
+	Sprite *sprite = &renderer->SpriteData;
+
+	if (renderer->BoundsValid && !transform->Parent
+		&& renderer->CachedPosition == transform->Position
+		&& renderer->CachedRotation == transform->Rotation
+		&& renderer->CachedScale == transform->Scale
+		&& renderer->CachedSpritePos == sprite->Pos
+		&& renderer->CachedSpriteSize == sprite->Size)
 	{
-		ActivateShader(&MainShader);
+		return;
+	}
 
-		glUniformMatrix4fv(GetUniformLocation(&MainShader, UNIFORMS::PROJECTION_MATRIX), 1, true, CalcProjection(&Scene->MainCamera).Elements_1D);
-		glUniformMatrix4fv(GetUniformLocation(&MainShader, UNIFORMS::VIEW_MATRIX), 1, true, CalcLookAtViewMatrix(&Scene->MainCamera).Elements_1D);
-		
-		glUniform1i(GetUniformLocation(&MainShader, UNIFORMS::TEXTURE0), 0);
-	
-		for (uint32 i = 0; i < renderers->size(); i++)
+	mat4f model = transform->ModelMatrix();
+
+	vec3f center = model * sprite->Pos;
+	vec3f right = model * vec3f(sprite->Pos.X + sprite->Size.X / 2.0f, sprite->Pos.Y, sprite->Pos.Z);
+	vec3f up = model * vec3f(sprite->Pos.X, sprite->Pos.Y + sprite->Size.Y / 2.0f, sprite->Pos.Z);
+
+	//NOTE(kai): half extents of the rotated quad are the sums of its half axes on each world axis
+	float halfX = fabsf(right.X - center.X) + fabsf(up.X - center.X);
+	float halfY = fabsf(right.Y - center.Y) + fabsf(up.Y - center.Y);
+
+	renderer->CachedModel = model;
+	renderer->WorldBounds = BoundingRect{ center.X - halfX, center.Y - halfY, center.X + halfX, center.Y + halfY };
+
+	renderer->CachedPosition = transform->Position;
+	renderer->CachedRotation = transform->Rotation;
+	renderer->CachedScale = transform->Scale;
+	renderer->CachedSpritePos = sprite->Pos;
+	renderer->CachedSpriteSize = sprite->Size;
+	renderer->BoundsValid = true;
+}
+
+void RenderingEngine::CaptureSnapshot(RenderSnapshot *snapshot, bool debug)
+{
+	//NOTE(kai): a snapshot the render thread never got to still has its fence
+	if (snapshot->Fence)
+	{
+		glDeleteSync(snapshot->Fence);
+		snapshot->Fence = 0;
+	}
+
+	BoundingRect view = CalcViewRect(&Scene->MainCamera);
+
+	snapshot->Projection = CalcProjection(&Scene->MainCamera);
+	snapshot->View = CalcLookAtViewMatrix(&Scene->MainCamera);
+	snapshot->ViewRect = view;
+	snapshot->Debug = debug;
+
+	CaptureTileMaps(snapshot, &view);
+	CaptureSprites(snapshot, &view);
+
+	snapshot->DebugBoxes.clear();
+
+	if (debug)
+	{
+		CaptureDebugBoxes(snapshot);
+	}
+
+	if (Threaded)
+	{
+		if (GLEW_ARB_sync)
+		{
+			snapshot->Fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+			glFlush();
+		}
+		else
 		{
-			SpriteRenderer *renderer = (SpriteRenderer *)(*renderers)[i];
+			glFinish();
+		}
+	}
+}
 
-			if (Scene->CurrentRoot)
-			{
-				if (renderer->Owner->CurrentRoot != Scene->CurrentRoot->Name
-					|| renderer->Owner->CurrentRoot != Scene->CurrentRoot->Name)
-				{
-					continue;
-				}
-			}		
-
-			if (!renderer->Owner->Enabled)
+void RenderingEngine::DrawSnapshot(RenderSnapshot *snapshot)
+{
+	if (snapshot->Fence)
+	{
+		glWaitSync(snapshot->Fence, 0, GL_TIMEOUT_IGNORED);
+		glDeleteSync(snapshot->Fence);
+		snapshot->Fence = 0;
+	}
+
+	//NOTE(kai): whatever the update thread let go of before this snapshot was taken isn't in it or in any one still to come
+	ReleaseDeferredDeletes(snapshot->Frame);
+
+	BeginGpuFrame(&Timers);
+
+	BeginGpuPass(&Timers, GPU_PASS_TILE_MAPS);
+	DrawTileChunks(snapshot);
+	EndGpuPass(&Timers);
+
+	BeginGpuPass(&Timers, GPU_PASS_SPRITES);
+	DrawSprites(snapshot, 0, snapshot->UIStart, &Sprites, &Instances);
+	EndGpuPass(&Timers);
+
+	BeginGpuPass(&Timers, GPU_PASS_UI);
+	DrawSprites(snapshot, snapshot->UIStart, (uint32)snapshot->Sprites.size(), &UISprites, &UIInstances);
+	EndGpuPass(&Timers);
+
+	if (snapshot->Debug)
+	{
+		BeginGpuPass(&Timers, GPU_PASS_DEBUG);
+		DrawDebugBoxes(snapshot);
+		EndGpuPass(&Timers);
+	}
+
+	for (uint32 i = 0; i < GPU_PASS_COUNT; i++)
+	{
+		Stats.GpuPassTimes[i] = Timers.PassTimes[i];
+	}
+
+	Stats.GpuFrameTime = GetGpuFrameTime(&Timers);
+}
+
+void RenderingEngine::CaptureTileMaps(RenderSnapshot *snapshot, BoundingRect *view)
+{
+	std::vector<GameComponent *> *tileMaps = Scene->GetAllComponents("TILEMAP");
+
+	snapshot->Chunks.clear();
+
+	VisibleChunks = 0;
+	CulledChunks = 0;
+
+	if (!tileMaps)
+	{
+		return;
+	}
+
+	for (uint32 i = 0; i < tileMaps->size(); i++)
+	{
+		TileMapRenderer *tileMap = (TileMapRenderer *)(*tileMaps)[i];
+
+		if (Scene->CurrentRoot && tileMap->Owner->CurrentRoot != Scene->CurrentRoot->Name)
+		{
+			continue;
+		}
+
+		if (!tileMap->Owner->Enabled)
+		{
+			continue;
+		}
+
+		VisibleChunks += CollectTileChunks(tileMap, view, &snapshot->Chunks, &CulledChunks);
+	}
+}
+
+struct CullJob
+{
+	RenderingEngine *Engine;
+	std::vector<GameComponent *> *Renderers;
+	BoundingRect View;
+};
+
+file_internal void CullRenderersJob(void *data, uint32 begin, uint32 end, uint32 threadIndex)
+{
+	CullJob *job = (CullJob *)data;
+	job->Engine->CullRenderers(job->Renderers, &job->View, begin, end, threadIndex);
+}
+
+file_internal void SortQueuesJob(void *data, uint32 begin, uint32 end, uint32 threadIndex)
+{
+	RenderQueue *queues = (RenderQueue *)data;
+
+	for (uint32 i = begin; i < end; i++)
+	{
+		SortRenderQueue(&queues[i]);
+	}
+}
+
+void RenderingEngine::CullRenderers(std::vector<GameComponent *> *renderers, BoundingRect *view, uint32 begin, uint32 end, uint32 threadIndex)
+{
+	RenderQueue *queue = &ThreadQueues[threadIndex];
+
+	for (uint32 i = begin; i < end; i++)
+	{
+		SpriteRenderer *renderer = (SpriteRenderer *)(*renderers)[i];
+
+		if (Scene->CurrentRoot)
+		{
+			if (renderer->Owner->CurrentRoot != Scene->CurrentRoot->Name
+				|| renderer->Owner->CurrentRoot != Scene->CurrentRoot->Name)
 			{
 				continue;
 			}
+		}		
 
-			glUniformMatrix4fv(GetUniformLocation(&MainShader, UNIFORMS::MODEL_MATRIX), 1, true, renderer->Owner->ObjectTransform.ModelMatrix().Elements_1D);
-			renderer->Render();
+		if (!renderer->Owner->Enabled)
+		{
+			continue;
 		}
-	}	
+
+		//NOTE(kai): only writes the renderer's own cache, every renderer goes to exactly one job
+		UpdateRendererBounds(renderer);
+
+		if (!RectsOverlap(&renderer->WorldBounds, view))
+		{
+			ThreadCulled[threadIndex]++;
+			continue;
+		}
+
+		ThreadVisible[threadIndex]++;
+
+		PushRenderItem(queue, &renderer->SpriteData, &renderer->CachedModel, renderer->RenderLayer, i);
+	}
 }
 
-void RenderingEngine::DebugRender()
+void RenderingEngine::CaptureSprites(RenderSnapshot *snapshot, BoundingRect *view)
 {
-	//std::vector<GameComponent *> *renderers = Scene->GetAllComponents("RENDERABLE");
-	std::vector<GameComponent *> *colliders = Scene->GetAllComponents("COLLIDER");
+	std::vector<GameComponent *> *renderers = Scene->GetAllComponents("RENDERABLE");
+	std::vector<GameComponent *> *layers = Scene->GetAllComponents("PARALLAX");
 
-	ActivateShader(&DebugShader);
+	uint32 threadCount = Scene->Jobs.GetThreadCount();
 
-	glUniformMatrix4fv(GetUniformLocation(&DebugShader, UNIFORMS::PROJECTION_MATRIX), 1, true, CalcProjection(&Scene->MainCamera).Elements_1D);
-	glUniformMatrix4fv(GetUniformLocation(&DebugShader, UNIFORMS::MODEL_MATRIX), 1, true, mat4f().Elements_1D);
-	
-	uint32 totalCount = 0;
-	/*
-	if (renderers)
+	for (uint32 i = 0; i < threadCount; i++)
 	{
-		totalCount += renderers->size();
+		ClearRenderQueue(&ThreadQueues[i]);
+		ThreadVisible[i] = 0;
+		ThreadCulled[i] = 0;
 	}
-	*/
 
-	if (colliders)
+	uint32 rendererCount = renderers ? (uint32)renderers->size() : 0;
+
+	if (rendererCount)
 	{
-		totalCount += colliders->size();
+		CullJob job = { this, renderers, *view };
+
+		Scene->Jobs.ParallelFor(rendererCount, 64, CullRenderersJob, &job);
 	}
 
-	BeginBatch(&this->DebugBatch, SPRITE_BATCH, totalCount, true);
-	
-	if (colliders)
+	VisibleSprites = 0;
+	CulledSprites = 0;
+
+	for (uint32 i = 0; i < threadCount; i++)
+	{
+		VisibleSprites += ThreadVisible[i];
+		CulledSprites += ThreadCulled[i];
+	}
+
+	//NOTE(kai): the layers go through the queue like any sprite so they sort in between the game's own layers.
+	//			 There are only ever a few, they go after the renderers on this thread
+	for (uint32 i = 0; layers && i < layers->size(); i++)
 	{
-		for (uint32 i = 0; i < colliders->size(); i++)
+		ParallaxLayer *layer = (ParallaxLayer *)(*layers)[i];
+
+		if (Scene->CurrentRoot && layer->Owner->CurrentRoot != Scene->CurrentRoot->Name)
 		{
-			Collider *collider = (Collider *)(*colliders)[i];
-			
-			if (Scene->CurrentRoot)
-			{
-				if (collider->Owner->CurrentRoot != Scene->CurrentRoot->Name)
-				{
-					continue;
-				}
-			}
+			continue;
+		}
+
+		if (!layer->Owner->Enabled)
+		{
+			continue;
+		}
+
+		VisibleSprites += PushParallaxLayer(&ThreadQueues[0], layer, view, Scene->MainCamera.Eye.X, rendererCount + i);
+	}
+
+	Scene->Jobs.ParallelFor(threadCount, 1, SortQueuesJob, ThreadQueues);
+
+	MergeRenderQueues(ThreadQueues, threadCount, &Merged);
+
+	uint32 count = (uint32)Merged.size();
 
-			if (!collider->Owner->Enabled)
+	//NOTE(kai): the queues point into the components, the snapshot gets its own copies in draw order
+	snapshot->Sprites.resize(count);
+	snapshot->UIStart = count;
+
+	for (uint32 i = 0; i < count; i++)
+	{
+		snapshot->Sprites[i].SpriteData = *Merged[i]->SpriteData;
+		snapshot->Sprites[i].Model = Merged[i]->Model;
+
+		//NOTE(kai): layers sort first, the UI is whatever comes after the first UI sprite
+		if (Merged[i]->Layer >= RENDER_LAYER_UI && snapshot->UIStart == count)
+		{
+			snapshot->UIStart = i;
+		}
+	}
+}
+
+void RenderingEngine::CaptureDebugBoxes(RenderSnapshot *snapshot)
+{
+	std::vector<GameComponent *> *colliders = Scene->GetAllComponents("COLLIDER");
+
+	if (!colliders)
+	{
+		return;
+	}
+
+	for (uint32 i = 0; i < colliders->size(); i++)
+	{
+		Collider *collider = (Collider *)(*colliders)[i];
+			
+		if (Scene->CurrentRoot)
+		{
+			if (collider->Owner->CurrentRoot != Scene->CurrentRoot->Name)
 			{
 				continue;
 			}
+		}
 
-			DebugBatch.Stop = false;
-			AddSprite(&DebugBatch
-				, *collider->pos + vec3f(collider->offset.X, collider->offset.Y, 0)
-				, collider->size
-				, vec4f(0, 0, 1, 1)
-				, 0
-				, true
-				, mat4f());
+		if (!collider->Owner->Enabled)
+		{
+			continue;
 		}
+
+		snapshot->DebugBoxes.push_back(SnapshotBox{ *collider->pos + vec3f(collider->offset.X, collider->offset.Y, 0), collider->size });
 	}
-	/*
-	if (renderers)
+}
+
+void RenderingEngine::DrawTileChunks(RenderSnapshot *snapshot)
+{
+	if (snapshot->Chunks.empty())
 	{
-		for (uint32 i = 0; i < renderers->size(); i++)
-		{
-			SpriteRenderer *renderer = (SpriteRenderer *)(*renderers)[i];
+		return;
+	}
 
-			if (Scene->CurrentRoot)
-			{
-				if (renderer->Owner->CurrentRoot != Scene->CurrentRoot->Name)
-				{
-					continue;
-				}
-			}			
-
-			DebugBatch.Stop = false;
-			AddSprite(&DebugBatch
-				, renderer->SpriteData.Pos
-				, renderer->SpriteData.Size
-				, vec4f(1, 0, 0, 1)
-				, renderer->SpriteData.Skin.MeshTexture.TextureHandle
-				, true
-				, renderer->Owner->ObjectTransform.ModelMatrix());
+	mat4f identity = mat4f();
+
+	ActivateShader(&MainShader);
+
+	SetUniformMatrix(&MainShader, UNIFORMS::PROJECTION_MATRIX, &snapshot->Projection);
+	SetUniformMatrix(&MainShader, UNIFORMS::MODEL_MATRIX, &identity);
+
+	for (uint32 i = 0; i < snapshot->Chunks.size(); i++)
+	{
+		SnapshotChunk *chunk = &snapshot->Chunks[i];
+
+		BindTexture2D(0, chunk->Texture);
+
+		Mesh buffers = {};
+		buffers.VBO = chunk->VBO;
+		buffers.EBO = chunk->EBO;
+		buffers.Format = GetSpriteVertexFormat();
+
+		BindMeshLayout(&ChunkLayout, &buffers);
+
+		glDrawElements(GL_TRIANGLES, chunk->QuadCount * 6, GL_UNSIGNED_INT, NULL);
+	}
+}
+
+void RenderingEngine::DrawSprites(RenderSnapshot *snapshot, uint32 first, uint32 end, SpriteBatch *sprites, SpriteInstanceBatch *instances)
+{
+	uint32 count = end - first;
+
+	if (!count)
+	{
+		return;
+	}
+
+	bool instanced = InstancedShader.ProgramHandle && InstancingSupported();
+	Shader *shader = instanced ? &InstancedShader : &MainShader;
+
+	ActivateShader(shader);
+
+	//NOTE(kai): a camera that didn't move leaves both uploads in the shader's uniform cache
+	SetUniformMatrix(shader, UNIFORMS::PROJECTION_MATRIX, &snapshot->Projection);
+	SetUniformMatrix(shader, UNIFORMS::VIEW_MATRIX, &snapshot->View);
+
+	if (instanced)
+	{
+		BeginInstanceBatch(instances, count);
+	}
+	else
+	{
+		BeginSpriteBatch(sprites, count);
+	}
+
+	for (uint32 i = first; i < end; i++)
+	{
+		SnapshotSprite *sprite = &snapshot->Sprites[i];
+
+		if (instanced)
+		{
+			AddSpriteInstance(instances, &sprite->SpriteData, &sprite->Model);
+		}
+		else
+		{
+			AddSpriteToBatch(sprites, &sprite->SpriteData, &sprite->Model);
 		}
 	}
-	
-	*/
-	EndBatch(&DebugBatch, true);
+
+	if (instanced)
+	{
+		EndInstanceBatch(instances);
+	}
+	else
+	{
+		//NOTE(kai): the quads are already in world space
+		mat4f identity = mat4f();
+		SetUniformMatrix(&MainShader, UNIFORMS::MODEL_MATRIX, &identity);
+
+		EndSpriteBatch(sprites);
+	}
 }
 
-void RenderingEngine::Update()
+void RenderingEngine::DrawDebugBoxes(RenderSnapshot *snapshot)
 {
-	DebugRender();
+	ActivateShader(&DebugShader);
+
+	mat4f identity = mat4f();
+
+	SetUniformMatrix(&DebugShader, UNIFORMS::PROJECTION_MATRIX, &snapshot->Projection);
+	SetUniformMatrix(&DebugShader, UNIFORMS::MODEL_MATRIX, &identity);
+
+	//NOTE(kai): the boxes, then the GPU time overlay
+	BeginBatch(&this->DebugBatch, SPRITE_BATCH, (uint32)snapshot->DebugBoxes.size() + GPU_PASS_COUNT + 1, true);
+
+	for (uint32 i = 0; i < snapshot->DebugBoxes.size(); i++)
+	{
+		SnapshotBox *box = &snapshot->DebugBoxes[i];
+
+		DebugBatch.Stop = false;
+		AddSprite(&DebugBatch
+			, box->Pos
+			, box->Size
+			, vec4f(0, 0, 1, 1)
+			, 0
+			, true
+			, mat4f());
+	}
+
+	//NOTE(kai): one bar per pass in the top left corner of the view, inside a box a whole frame's budget wide
+	BoundingRect *view = &snapshot->ViewRect;
+
+	float budgetWidth = (view->MaxX - view->MinX) * 0.25f;
+	float barHeight = (view->MaxY - view->MinY) * 0.02f;
+	float left = view->MinX + barHeight;
+	float top = view->MaxY - barHeight;
+
+	vec4f colors[GPU_PASS_COUNT] =
+	{
+		vec4f(0, 1, 0, 1),
+		vec4f(0, 1, 1, 1),
+		vec4f(1, 1, 0, 1),
+		vec4f(1, 0, 0, 1),
+	};
+
+	DebugBatch.Stop = false;
+	AddSprite(&DebugBatch
+		, vec3f(left + budgetWidth / 2.0f, top - GPU_PASS_COUNT * barHeight / 2.0f, 0)
+		, vec3f(budgetWidth, GPU_PASS_COUNT * barHeight, 0)
+		, vec4f(1, 1, 1, 1)
+		, 0
+		, true
+		, mat4f());
+
+	for (uint32 i = 0; i < GPU_PASS_COUNT; i++)
+	{
+		float width = budgetWidth * min(Timers.PassTimes[i] / GPU_OVERLAY_BUDGET, 1.0f);
+
+		DebugBatch.Stop = false;
+		AddSprite(&DebugBatch
+			, vec3f(left + width / 2.0f, top - (i + 0.5f) * barHeight, 0)
+			, vec3f(width, barHeight * 0.8f, 0)
+			, colors[i]
+			, 0
+			, true
+			, mat4f());
+	}
+
+	EndBatch(&DebugBatch, true);
 }
 
 void RenderingEngine::InitShader(char *vertexShader, char *fragmentShader)
 {
-	char **attributelocations = 0;
-	attributelocations = new char*[4];
-	attributelocations[0] = "position";
-	attributelocations[1] = "inputTexCoords";
-	attributelocations[2] = "color";
-	attributelocations[3] = "slot";
-	attributelocations[4] = "normal";
-	
-	MainShader = CreateShader(vertexShader, fragmentShader, attributelocations, 4);
+	//NOTE(kai): the main shader only ever draws the sprite batch
+	MainShader = CreateShader(vertexShader, fragmentShader, GetSpriteVertexFormat());
 
 	AddUniform(&MainShader, UNIFORMS::MODEL_MATRIX, "modelMatrix");
 	AddUniform(&MainShader, UNIFORMS::VIEW_MATRIX, "viewMatrix");
 	AddUniform(&MainShader, UNIFORMS::PROJECTION_MATRIX, "projectionMatrix");
 
 	AddUniform(&MainShader, UNIFORMS::TEXTURE0, "myTexture0");
+
+	//NOTE(kai): every draw samples unit 0, set once here instead of every frame
+	SetUniformInt(&MainShader, UNIFORMS::TEXTURE0, 0);
 }
 
 void RenderingEngine::InitDebugShader(char *vertexShader, char *fragmentShader)
 {
-	char **attributelocations = 0;
-	attributelocations = new char*[4];
-	attributelocations[0] = "position";
-	attributelocations[1] = "inputTexCoords";
-	attributelocations[2] = "color";
-	attributelocations[3] = "slot";
-	attributelocations[4] = "normal";
-
-	DebugShader = CreateShader(vertexShader, fragmentShader, attributelocations, 4);
+	DebugShader = CreateShader(vertexShader, fragmentShader, GetMeshVertexFormat());
 
 	AddUniform(&DebugShader, UNIFORMS::MODEL_MATRIX, "modelMatrix");
 	AddUniform(&DebugShader, UNIFORMS::VIEW_MATRIX, "viewMatrix");
 	AddUniform(&DebugShader, UNIFORMS::PROJECTION_MATRIX, "projectionMatrix");
+}
+
+void RenderingEngine::InitInstancedShader(char *vertexShader, char *fragmentShader)
+{
+	char *attributelocations[] =
+	{
+		"corner",
+		"axes",
+		"origin",
+		"uvRect",
+		"color",
+	};
+
+	InstancedShader = CreateShader(vertexShader, fragmentShader, attributelocations, 5);
+
+	//NOTE(kai): a driver that can't build it falls back to the CPU batch instead of drawing nothing
+	int linked = 0;
+	glGetProgramiv(InstancedShader.ProgramHandle, GL_LINK_STATUS, &linked);
+
+	if (!linked)
+	{
+		DeleteProgram(&InstancedShader.ProgramHandle);
+		InstancedShader = {};
+
+		return;
+	}
+
+	AddUniform(&InstancedShader, UNIFORMS::VIEW_MATRIX, "viewMatrix");
+	AddUniform(&InstancedShader, UNIFORMS::PROJECTION_MATRIX, "projectionMatrix");
+
+	AddUniform(&InstancedShader, UNIFORMS::TEXTURE0, "myTexture0");
+
+	SetUniformInt(&InstancedShader, UNIFORMS::TEXTURE0, 0);
 }
\ No newline at end of file
@@ -9,6 +9,7 @@ void SceneManager::Init(uint32 maxObjectCount)
 	StateObjects["Main Root"] = new Objects();
 	Root = AddObject("Main Root", "Main Root");
 	Root->CurrentRoot = "";
+	Jobs.Init();
 	REngine.Init();
 	REngine.Scene = this;
 	PEngine.Init();
@@ -195,6 +196,12 @@ void SceneManager::RemoveObject(char *name)
 }
 
 void SceneManager::Render()
+{
+	CaptureFrame(&REngine.Frame);
+	RenderFrame(&REngine.Frame);
+}
+
+void SceneManager::CaptureFrame(RenderSnapshot *snapshot)
 {
 	if (CurrentRoot)
 	{
@@ -205,12 +212,12 @@ void SceneManager::Render()
 		Root->RenderAll();
 	}
 
-	REngine.Render();
-	
-	if (Debug)
-	{
-		REngine.DebugRender();
-	}
+	REngine.CaptureSnapshot(snapshot, Debug);
+}
+
+void SceneManager::RenderFrame(RenderSnapshot *snapshot)
+{
+	REngine.DrawSnapshot(snapshot);
 }
 
 void SceneManager::Update(float delta, Game_Input *input)
@@ -227,7 +234,7 @@ void SceneManager::Update(float delta, Game_Input *input)
 
 	Delta = delta;
 	
-	PEngine.Update();
+	PEngine.Update(delta);
 
 	if (CurrentRoot)
 	{
@@ -237,6 +244,9 @@ void SceneManager::Update(float delta, Game_Input *input)
 	{
 		Root->UpdateAll(delta, input);
 	}
+
+	//NOTE(kai): after the components so clips switched this frame already show their first frame
+	UpdateAnimations(&Animations, delta);
 }
 
 void SceneManager::AddComponentPool(GameComponent *component)
@@ -318,6 +328,11 @@ void SceneManager::RemoveComponent(GameComponent *comp)
 {
 	if (comp)
 	{
+		if (comp->Type == "COLLIDER")
+		{
+			PEngine.RemoveCollider((Collider *)comp);
+		}
+
 		std::vector<GameComponent *> *components = GetAllComponents(comp->Type);
 
 		if (components)
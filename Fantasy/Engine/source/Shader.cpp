@@ -30,6 +30,18 @@ Shader CreateShader(char *vertexPath, char *fragmentPath, char **attributeLocati
 	return shader;
 }
 
+Shader CreateShader(char *vertexPath, char *fragmentPath, VertexFormat *format)
+{
+	char *attributeLocations[VERTEX_FORMAT_MAX_ATTRIBUTES];
+
+	for (uint32 i = 0; i < format->AttributeCount; i++)
+	{
+		attributeLocations[i] = format->Attributes[i].Name;
+	}
+
+	return CreateShader(vertexPath, fragmentPath, attributeLocations, format->AttributeCount);
+}
+
 //Add a shader into the program  
 void AddShader(Shader *shader, char *path, ShaderType type)
 {
@@ -144,9 +156,11 @@ void ActivateShader(Shader *shader)
 {
 	if (!shader)
 	{
-		glUseProgram(0);
+		UseProgram(0);
+		return;
 	}
-	glUseProgram(shader->ProgramHandle);
+
+	UseProgram(shader->ProgramHandle);
 }
 
 unsigned int GetUniformLocation(Shader *shader, UNIFORMS uniformType)
@@ -157,4 +171,58 @@ unsigned int GetUniformLocation(Shader *shader, UNIFORMS uniformType)
 void AddUniform(Shader *shader, UNIFORMS type, char *name)
 {
 	shader->UniformLocations[type] = glGetUniformLocation(shader->ProgramHandle, name);
+	shader->CachedUniforms &= ~(1 << type);
+}
+
+void SetUniformMatrix(Shader *shader, UNIFORMS uniformType, mat4f *matrix)
+{
+	int location = (int)shader->UniformLocations[uniformType];
+
+	if (location < 0)
+	{
+		return;
+	}
+
+	uint32 bit = 1 << uniformType;
+
+	if ((shader->CachedUniforms & bit) && memcmp(shader->UniformValues[uniformType], matrix->Elements_1D, 16 * sizeof(float)) == 0)
+	{
+		GetGLState()->Skipped++;
+		return;
+	}
+
+	UseProgram(shader->ProgramHandle);
+	glUniformMatrix4fv(location, 1, true, matrix->Elements_1D);
+
+	memcpy(shader->UniformValues[uniformType], matrix->Elements_1D, 16 * sizeof(float));
+	shader->CachedUniforms |= bit;
+
+	GetGLState()->Issued++;
+}
+
+void SetUniformInt(Shader *shader, UNIFORMS uniformType, int value)
+{
+	int location = (int)shader->UniformLocations[uniformType];
+
+	if (location < 0)
+	{
+		return;
+	}
+
+	uint32 bit = 1 << uniformType;
+	float stored = (float)value;
+
+	if ((shader->CachedUniforms & bit) && shader->UniformValues[uniformType][0] == stored)
+	{
+		GetGLState()->Skipped++;
+		return;
+	}
+
+	UseProgram(shader->ProgramHandle);
+	glUniform1i(location, value);
+
+	shader->UniformValues[uniformType][0] = stored;
+	shader->CachedUniforms |= bit;
+
+	GetGLState()->Issued++;
 }
\ No newline at end of file
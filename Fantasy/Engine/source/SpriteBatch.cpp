@@ -0,0 +1,302 @@
+#include <SpriteBatch.h>
+
+void BeginSpriteBatch(SpriteBatch *batch, uint32 maxCount)
+{
+	batch->Runs.clear();
+
+	batch->MaxCount = maxCount;
+	batch->SpriteCount = 0;
+	batch->DrawCalls = 0;
+	batch->Write = NULL;
+
+	if (!maxCount)
+	{
+		return;
+	}
+
+	if (ReserveStream(&batch->Stream, GL_ARRAY_BUFFER, maxCount * 4 * sizeof(SpriteVertex)))
+	{
+		for (uint32 i = 0; i < STREAM_BUFFER_FRAMES; i++)
+		{
+			ResetMeshLayout(&batch->Layouts[i]);
+		}
+	}
+
+	ReserveQuadIndices(&batch->Indices, maxCount, false);
+
+	batch->Write = (SpriteVertex *)BeginStream(&batch->Stream, &batch->WriteOffset);
+}
+
+void AddSpriteToBatch(SpriteBatch *batch, Sprite *sprite, mat4f *model)
+{
+	if (batch->SpriteCount >= batch->MaxCount)
+	{
+		return;
+	}
+
+	vec3f pos = sprite->Pos;
+	vec3f size = sprite->Size;
+	vec4f uv = TextureRegionUV(&sprite->Skin.MeshTexture, sprite->UVRect);
+	vec4f color = sprite->Color;
+
+	vec3f lowerLeft = vec3f(pos.X - (size.X / 2.0f), pos.Y - (size.Y / 2.0f), pos.Z);
+	vec3f upperLeft = vec3f(pos.X - (size.X / 2.0f), pos.Y + (size.Y / 2.0f), pos.Z);
+	vec3f lowerRight = vec3f(pos.X + (size.X / 2.0f), pos.Y - (size.Y / 2.0f), pos.Z);
+	vec3f upperRight = vec3f(pos.X + (size.X / 2.0f), pos.Y + (size.Y / 2.0f), pos.Z);
+
+	lowerLeft = *model * lowerLeft;
+	upperLeft = *model * upperLeft;
+	lowerRight = *model * lowerRight;
+	upperRight = *model * upperRight;
+
+	uint16 left = ToUnorm16(uv.X);
+	uint16 right = ToUnorm16(uv.X + uv.Z);
+	uint16 bottom = ToUnorm16(uv.Y);
+	uint16 top = ToUnorm16(uv.Y + uv.W);
+
+	uint8 r = ToUnorm8(color.X);
+	uint8 g = ToUnorm8(color.Y);
+	uint8 b = ToUnorm8(color.Z);
+	uint8 a = ToUnorm8(color.W);
+
+	//NOTE(kai): built on the stack and copied once, the stream memory may be write combined
+	SpriteVertex quad[4] =
+	{
+		{ { lowerLeft.X, lowerLeft.Y }, { left, bottom }, { r, g, b, a } },
+		{ { upperLeft.X, upperLeft.Y }, { left, top }, { r, g, b, a } },
+		{ { upperRight.X, upperRight.Y }, { right, top }, { r, g, b, a } },
+		{ { lowerRight.X, lowerRight.Y }, { right, bottom }, { r, g, b, a } },
+	};
+
+	memcpy(batch->Write + batch->SpriteCount * 4, quad, sizeof(quad));
+
+	uint32 texture = sprite->Skin.MeshTexture.TextureHandle;
+
+	//NOTE(kai): only neighbours get merged, the render queue has already put sprites that may share a draw together
+	if (batch->Runs.empty() || batch->Runs.back().TextureHandle != texture)
+	{
+		batch->Runs.push_back(SpriteBatchRun{ texture, batch->SpriteCount, 0 });
+	}
+
+	batch->Runs.back().Count++;
+	batch->SpriteCount++;
+}
+
+void EndSpriteBatch(SpriteBatch *batch)
+{
+	if (!batch->SpriteCount)
+	{
+		return;
+	}
+
+	EndStream(&batch->Stream, batch->SpriteCount * 4 * sizeof(SpriteVertex));
+
+	Mesh buffers = {};
+	buffers.VBO = batch->Stream.Handle;
+	buffers.EBO = batch->Indices.Handle;
+	buffers.Format = GetSpriteVertexFormat();
+
+	BindMeshLayout(&batch->Layouts[batch->Stream.Region], &buffers, batch->WriteOffset);
+
+	for (uint32 i = 0; i < batch->Runs.size(); i++)
+	{
+		SpriteBatchRun *run = &batch->Runs[i];
+
+		BindTexture2D(0, run->TextureHandle);
+		glDrawElements(GL_TRIANGLES, run->Count * 6, GL_UNSIGNED_INT, (void *)(run->First * 6 * sizeof(uint32)));
+	}
+
+	batch->DrawCalls = (uint32)batch->Runs.size();
+
+	FenceStream(&batch->Stream);
+}
+
+file_internal void CreateInstanceQuad(SpriteInstanceBatch *batch)
+{
+	float corners[] =
+	{
+		-0.5f, -0.5f,
+		-0.5f, 0.5f,
+		0.5f, 0.5f,
+		0.5f, -0.5f,
+	};
+
+	uint32 indices[] =
+	{
+		0, 1, 3,
+		1, 2, 3,
+	};
+
+	glGenBuffers(1, &batch->QuadVBO);
+	glGenBuffers(1, &batch->QuadEBO);
+
+	UnbindVertexArray();
+
+	BindBuffer(GL_ARRAY_BUFFER, batch->QuadVBO);
+	glBufferData(GL_ARRAY_BUFFER, sizeof(corners), corners, GL_STATIC_DRAW);
+
+	BindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch->QuadEBO);
+	glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
+
+	UnbindMesh();
+}
+
+file_internal void SetInstancePointers(uint32 offset, uint32 first)
+{
+	uint8 *base = (uint8 *)0 + offset + first * sizeof(SpriteInstance);
+
+	glVertexAttribPointer(INSTANCE_AXES, 4, GL_FLOAT, GL_FALSE, sizeof(SpriteInstance), base + offsetof(SpriteInstance, Axes));
+	glVertexAttribPointer(INSTANCE_ORIGIN, 4, GL_FLOAT, GL_FALSE, sizeof(SpriteInstance), base + offsetof(SpriteInstance, Origin));
+	glVertexAttribPointer(INSTANCE_UV_RECT, 4, GL_UNSIGNED_SHORT, GL_TRUE, sizeof(SpriteInstance), base + offsetof(SpriteInstance, UVRect));
+	glVertexAttribPointer(INSTANCE_COLOR, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(SpriteInstance), base + offsetof(SpriteInstance, Color));
+}
+
+//NOTE(kai): everything but the instance pointers, written once into the batch's vertex array when there is one
+file_internal void SetInstanceLayout(SpriteInstanceBatch *batch)
+{
+	BindBuffer(GL_ARRAY_BUFFER, batch->QuadVBO);
+	glEnableVertexAttribArray(INSTANCE_CORNER);
+	glVertexAttribPointer(INSTANCE_CORNER, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), 0);
+
+	BindBuffer(GL_ELEMENT_ARRAY_BUFFER, batch->QuadEBO);
+
+	for (uint32 i = INSTANCE_AXES; i <= INSTANCE_COLOR; i++)
+	{
+		glEnableVertexAttribArray(i);
+		glVertexAttribDivisorARB(i, 1);
+	}
+}
+
+bool InstancingSupported()
+{
+	return GLEW_ARB_instanced_arrays ? true : false;
+}
+
+void BeginInstanceBatch(SpriteInstanceBatch *batch, uint32 maxCount)
+{
+	batch->Runs.clear();
+
+	batch->MaxCount = maxCount;
+	batch->SpriteCount = 0;
+	batch->DrawCalls = 0;
+	batch->Write = NULL;
+
+	if (!maxCount)
+	{
+		return;
+	}
+
+	ReserveStream(&batch->Stream, GL_ARRAY_BUFFER, maxCount * sizeof(SpriteInstance));
+
+	batch->Write = (SpriteInstance *)BeginStream(&batch->Stream, &batch->WriteOffset);
+}
+
+void AddSpriteInstance(SpriteInstanceBatch *batch, Sprite *sprite, mat4f *model)
+{
+	if (batch->SpriteCount >= batch->MaxCount)
+	{
+		return;
+	}
+
+	vec3f pos = sprite->Pos;
+	vec3f right = vec3f(pos.X + sprite->Size.X, pos.Y, pos.Z);
+	vec3f up = vec3f(pos.X, pos.Y + sprite->Size.Y, pos.Z);
+
+	//NOTE(kai): three points through the model matrix give the center and both axes, whatever the rotation
+	vec3f center = *model * pos;
+	right = *model * right;
+	up = *model * up;
+
+	//NOTE(kai): built on the stack and copied once, the stream memory may be write combined
+	SpriteInstance instance;
+
+	instance.Axes[0] = right.X - center.X;
+	instance.Axes[1] = right.Y - center.Y;
+	instance.Axes[2] = up.X - center.X;
+	instance.Axes[3] = up.Y - center.Y;
+
+	instance.Origin[0] = center.X;
+	instance.Origin[1] = center.Y;
+	instance.Origin[2] = center.Z;
+	instance.Origin[3] = 0.0f;
+
+	vec4f uv = TextureRegionUV(&sprite->Skin.MeshTexture, sprite->UVRect);
+
+	instance.UVRect[0] = ToUnorm16(uv.X);
+	instance.UVRect[1] = ToUnorm16(uv.Y);
+	instance.UVRect[2] = ToUnorm16(uv.Z);
+	instance.UVRect[3] = ToUnorm16(uv.W);
+
+	instance.Color[0] = ToUnorm8(sprite->Color.X);
+	instance.Color[1] = ToUnorm8(sprite->Color.Y);
+	instance.Color[2] = ToUnorm8(sprite->Color.Z);
+	instance.Color[3] = ToUnorm8(sprite->Color.W);
+
+	batch->Write[batch->SpriteCount] = instance;
+
+	uint32 texture = sprite->Skin.MeshTexture.TextureHandle;
+
+	if (batch->Runs.empty() || batch->Runs.back().TextureHandle != texture)
+	{
+		batch->Runs.push_back(SpriteBatchRun{ texture, batch->SpriteCount, 0 });
+	}
+
+	batch->Runs.back().Count++;
+	batch->SpriteCount++;
+}
+
+void EndInstanceBatch(SpriteInstanceBatch *batch)
+{
+	if (!batch->SpriteCount)
+	{
+		return;
+	}
+
+	if (!batch->QuadVBO)
+	{
+		CreateInstanceQuad(batch);
+	}
+
+	bool vertexArrays = VertexArraysSupported();
+
+	if (vertexArrays && batch->VertexArray)
+	{
+		BindVertexArray(batch->VertexArray);
+	}
+	else
+	{
+		if (vertexArrays)
+		{
+			glGenVertexArrays(1, &batch->VertexArray);
+			BindVertexArray(batch->VertexArray);
+		}
+
+		SetInstanceLayout(batch);
+	}
+
+	EndStream(&batch->Stream, batch->SpriteCount * sizeof(SpriteInstance));
+
+	//NOTE(kai): no base instance in GL 2, each run points the instance attributes at its first sprite instead
+	for (uint32 i = 0; i < batch->Runs.size(); i++)
+	{
+		SpriteBatchRun *run = &batch->Runs[i];
+
+		SetInstancePointers(batch->WriteOffset, run->First);
+
+		BindTexture2D(0, run->TextureHandle);
+		glDrawElementsInstancedARB(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0, run->Count);
+	}
+
+	batch->DrawCalls = (uint32)batch->Runs.size();
+
+	FenceStream(&batch->Stream);
+
+	//NOTE(kai): without vertex arrays BindMesh shares these locations and expects one value per vertex
+	if (!vertexArrays)
+	{
+		for (uint32 i = INSTANCE_AXES; i <= INSTANCE_COLOR; i++)
+		{
+			glVertexAttribDivisorARB(i, 0);
+		}
+	}
+}
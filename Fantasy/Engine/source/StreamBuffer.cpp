@@ -0,0 +1,127 @@
+#include <StreamBuffer.h>
+
+#define STREAM_MAP_FLAGS (GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT)
+
+file_internal void WaitFence(GLsync *fence)
+{
+	if (*fence)
+	{
+		//NOTE(kai): only ever blocks when the GPU is a whole ring behind
+		while (glClientWaitSync(*fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000) == GL_TIMEOUT_EXPIRED)
+		{
+		}
+
+		glDeleteSync(*fence);
+		*fence = 0;
+	}
+}
+
+bool ReserveStream(StreamBuffer *stream, uint32 target, uint32 size)
+{
+	if (stream->Handle && stream->RegionSize >= size)
+	{
+		return false;
+	}
+
+	uint32 regionSize = stream->RegionSize ? stream->RegionSize : Kilobytes(64);
+
+	while (regionSize < size)
+	{
+		regionSize *= 2;
+	}
+
+	DestroyStream(stream);
+
+	stream->Target = target;
+	stream->RegionSize = regionSize;
+	stream->Region = 0;
+
+	glGenBuffers(1, &stream->Handle);
+	BindBuffer(target, stream->Handle);
+
+	if (GLEW_ARB_buffer_storage && GLEW_ARB_sync)
+	{
+		glBufferStorage(target, regionSize * STREAM_BUFFER_FRAMES, NULL, STREAM_MAP_FLAGS);
+		stream->Mapped = (uint8 *)glMapBufferRange(target, 0, regionSize * STREAM_BUFFER_FRAMES, STREAM_MAP_FLAGS);
+		stream->Persistent = stream->Mapped != NULL;
+	}
+
+	if (!stream->Persistent)
+	{
+		//NOTE(kai): buffer storage is immutable, a failed map needs a fresh buffer
+		if (GLEW_ARB_buffer_storage && GLEW_ARB_sync)
+		{
+			DeleteBuffer(&stream->Handle);
+			glGenBuffers(1, &stream->Handle);
+			BindBuffer(target, stream->Handle);
+		}
+
+		glBufferData(target, regionSize, NULL, GL_STREAM_DRAW);
+		stream->Staging.resize(regionSize);
+	}
+
+	return true;
+}
+
+void DestroyStream(StreamBuffer *stream)
+{
+	if (!stream->Handle)
+	{
+		return;
+	}
+
+	for (uint32 i = 0; i < STREAM_BUFFER_FRAMES; i++)
+	{
+		WaitFence(&stream->Fences[i]);
+	}
+
+	if (stream->Mapped)
+	{
+		BindBuffer(stream->Target, stream->Handle);
+		glUnmapBuffer(stream->Target);
+	}
+
+	DeleteBuffer(&stream->Handle);
+
+	stream->Mapped = NULL;
+	stream->Persistent = false;
+	stream->Staging.clear();
+}
+
+void* BeginStream(StreamBuffer *stream, uint32 *offset)
+{
+	if (!stream->Persistent)
+	{
+		*offset = 0;
+
+		return stream->Staging.data();
+	}
+
+	stream->Region = (stream->Region + 1) % STREAM_BUFFER_FRAMES;
+
+	WaitFence(&stream->Fences[stream->Region]);
+
+	*offset = stream->Region * stream->RegionSize;
+
+	return stream->Mapped + *offset;
+}
+
+void EndStream(StreamBuffer *stream, uint32 size)
+{
+	BindBuffer(stream->Target, stream->Handle);
+
+	if (!stream->Persistent && size)
+	{
+		//NOTE(kai): orphaning hands the driver new storage instead of waiting on last frame's draws
+		glBufferData(stream->Target, stream->RegionSize, NULL, GL_STREAM_DRAW);
+		glBufferSubData(stream->Target, 0, size, stream->Staging.data());
+	}
+}
+
+void FenceStream(StreamBuffer *stream)
+{
+	if (stream->Persistent)
+	{
+		stream->Fences[stream->Region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	}
+}
@@ -1,6 +1,30 @@
 #include <FreeImage.h>
 #include "Texture.h"
 
+Texture CreateTexture(uint32 width, uint32 height, void *pixels)
+{
+	Texture texture = {};
+
+	texture.Width = width;
+	texture.Height = height;
+
+	glGenTextures(1, &texture.TextureHandle);
+
+	BindTexture2D(0, texture.TextureHandle);
+
+	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, texture.Width, texture.Height, 0, GL_BGRA, GL_UNSIGNED_BYTE, pixels);
+
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+
+	//glGenerateMipmap(GL_TEXTURE_2D);
+
+	return texture;
+}
+
 Texture LoadTexture(char *imagePath)
 {
 	FreeImage_Initialise();
@@ -32,24 +56,7 @@ Texture LoadTexture(char *imagePath)
 
 	bits = FreeImage_GetBits(dib);
 
-	texture.Width = FreeImage_GetWidth(dib);
-	texture.Height = FreeImage_GetHeight(dib);
-	
-	glGenTextures(1, &texture.TextureHandle);
-
-	glBindTexture(GL_TEXTURE_2D, texture.TextureHandle);
-
-	glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, texture.Width, texture.Height, 0, GL_BGRA, GL_UNSIGNED_BYTE, bits);
-
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-	glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-
-	//glGenerateMipmap(GL_TEXTURE_2D);
-
-	glBindTexture(GL_TEXTURE_2D, 0);
+	texture = CreateTexture(FreeImage_GetWidth(dib), FreeImage_GetHeight(dib), bits);
 
 	FreeImage_Unload(dib);
 
@@ -58,16 +65,30 @@ Texture LoadTexture(char *imagePath)
 	return texture;
 }
 
+vec4f TextureRegionUV(Texture *texture, vec4f uvRect)
+{
+	if (!texture->Packed)
+	{
+		return uvRect;
+	}
+
+	vec4f region = texture->Region;
+
+	return vec4f(region.X + uvRect.X * region.Z
+		, region.Y + uvRect.Y * region.W
+		, uvRect.Z * region.Z
+		, uvRect.W * region.W);
+}
+
 void BindTexture(Texture *texture)
 {
 	if (texture->TextureHandle)
 	{
-		glActiveTexture(GL_TEXTURE0);
-		glBindTexture(GL_TEXTURE_2D, texture->TextureHandle);
+		BindTexture2D(0, texture->TextureHandle);
 	}
 }
 
 void UnbindTexture()
 {
-	glBindTexture(GL_TEXTURE_2D, 0);
+	BindTexture2D(0, 0);
 }
@@ -0,0 +1,243 @@
+#include <FreeImage.h>
+#include <TextureAtlas.h>
+
+//NOTE(kai): lowest y a width wide rect can sit at when its left edge is on node index, -1 if it doesn't fit
+file_internal int32 SkylineFit(std::vector<SkylineNode> *skyline, uint32 index, uint32 pageSize, uint32 width, uint32 height)
+{
+	SkylineNode *node = &(*skyline)[index];
+
+	if (node->X + width > pageSize)
+	{
+		return -1;
+	}
+
+	int32 widthLeft = (int32)width;
+	uint32 y = node->Y;
+
+	for (uint32 i = index; widthLeft > 0; i++)
+	{
+		if (i >= skyline->size())
+		{
+			return -1;
+		}
+
+		if ((*skyline)[i].Y > y)
+		{
+			y = (*skyline)[i].Y;
+		}
+
+		if (y + height > pageSize)
+		{
+			return -1;
+		}
+
+		widthLeft -= (int32)(*skyline)[i].Width;
+	}
+
+	return (int32)y;
+}
+
+bool PackSkyline(std::vector<SkylineNode> *skyline, uint32 pageSize, uint32 width, uint32 height, uint32 *x, uint32 *y)
+{
+	if (skyline->empty())
+	{
+		skyline->push_back(SkylineNode{ 0, 0, pageSize });
+	}
+
+	int32 bestIndex = -1;
+	uint32 bestTop = 0;
+	uint32 bestWidth = 0;
+
+	//NOTE(kai): lowest top edge wins, the narrower segment breaks ties so wide gaps stay open
+	for (uint32 i = 0; i < skyline->size(); i++)
+	{
+		int32 fitY = SkylineFit(skyline, i, pageSize, width, height);
+
+		if (fitY < 0)
+		{
+			continue;
+		}
+
+		uint32 top = (uint32)fitY + height;
+
+		if (bestIndex < 0 || top < bestTop || (top == bestTop && (*skyline)[i].Width < bestWidth))
+		{
+			bestIndex = (int32)i;
+			bestTop = top;
+			bestWidth = (*skyline)[i].Width;
+			*x = (*skyline)[i].X;
+			*y = (uint32)fitY;
+		}
+	}
+
+	if (bestIndex < 0)
+	{
+		return false;
+	}
+
+	skyline->insert(skyline->begin() + bestIndex, SkylineNode{ *x, *y + height, width });
+
+	//NOTE(kai): cut away whatever the new segment now covers
+	for (uint32 i = bestIndex + 1; i < skyline->size();)
+	{
+		SkylineNode *previous = &(*skyline)[i - 1];
+		SkylineNode *node = &(*skyline)[i];
+
+		uint32 previousEnd = previous->X + previous->Width;
+
+		if (node->X >= previousEnd)
+		{
+			break;
+		}
+
+		uint32 shrink = previousEnd - node->X;
+
+		if (node->Width <= shrink)
+		{
+			skyline->erase(skyline->begin() + i);
+			continue;
+		}
+
+		node->X += shrink;
+		node->Width -= shrink;
+		break;
+	}
+
+	for (uint32 i = 0; i + 1 < skyline->size();)
+	{
+		if ((*skyline)[i].Y == (*skyline)[i + 1].Y)
+		{
+			(*skyline)[i].Width += (*skyline)[i + 1].Width;
+			skyline->erase(skyline->begin() + i + 1);
+			continue;
+		}
+
+		i++;
+	}
+
+	return true;
+}
+
+file_internal AtlasPage* AddAtlasPage(TextureAtlas *atlas)
+{
+	AtlasPage page = {};
+
+	//NOTE(kai): cleared so the padding between images never samples garbage
+	std::vector<uint8> clear(atlas->PageSize * atlas->PageSize * 4, 0);
+
+	Texture texture = CreateTexture(atlas->PageSize, atlas->PageSize, clear.data());
+
+	page.TextureHandle = texture.TextureHandle;
+	page.Skyline.push_back(SkylineNode{ 0, 0, atlas->PageSize });
+
+	atlas->Pages.push_back(page);
+
+	return &atlas->Pages.back();
+}
+
+Texture LoadAtlasTexture(TextureAtlas *atlas, char *imagePath)
+{
+	if (!atlas->PageSize)
+	{
+		GLint maxSize = 0;
+		glGetIntegerv(GL_MAX_TEXTURE_SIZE, &maxSize);
+
+		atlas->PageSize = maxSize > 0 && maxSize < ATLAS_PAGE_SIZE ? (uint32)maxSize : ATLAS_PAGE_SIZE;
+	}
+
+	FreeImage_Initialise();
+
+	FREE_IMAGE_FORMAT imageFormat = FreeImage_GetFileType(imagePath);
+
+	if (imageFormat == FIF_UNKNOWN)
+	{
+		imageFormat = FreeImage_GetFIFFromFilename(imagePath);
+	}
+
+	if (imageFormat == FIF_UNKNOWN || !FreeImage_FIFSupportsReading(imageFormat))
+	{
+		FreeImage_DeInitialise();
+
+		return Texture{};
+	}
+
+	FIBITMAP *dib = FreeImage_Load(imageFormat, imagePath);
+
+	if (!dib)
+	{
+		FreeImage_DeInitialise();
+
+		return Texture{};
+	}
+
+	if (FreeImage_GetBPP(dib) != 32)
+	{
+		FIBITMAP *converted = FreeImage_ConvertTo32Bits(dib);
+		FreeImage_Unload(dib);
+		dib = converted;
+	}
+
+	uint32 width = FreeImage_GetWidth(dib);
+	uint32 height = FreeImage_GetHeight(dib);
+	uint8 *bits = FreeImage_GetBits(dib);
+
+	Texture texture = {};
+
+	uint32 x = 0;
+	uint32 y = 0;
+	AtlasPage *page = NULL;
+
+	uint32 maxImageSize = ATLAS_MAX_IMAGE_SIZE < atlas->PageSize ? ATLAS_MAX_IMAGE_SIZE : atlas->PageSize - ATLAS_PADDING;
+
+	if (width <= maxImageSize && height <= maxImageSize)
+	{
+		//NOTE(kai): the padding goes right and above the image, a page's left and bottom edges are clamped anyway
+		for (uint32 i = 0; i < atlas->Pages.size() && !page; i++)
+		{
+			if (PackSkyline(&atlas->Pages[i].Skyline, atlas->PageSize, width + ATLAS_PADDING, height + ATLAS_PADDING, &x, &y))
+			{
+				page = &atlas->Pages[i];
+			}
+		}
+
+		if (!page)
+		{
+			page = AddAtlasPage(atlas);
+			PackSkyline(&page->Skyline, atlas->PageSize, width + ATLAS_PADDING, height + ATLAS_PADDING, &x, &y);
+		}
+	}
+
+	if (page)
+	{
+		BindTexture2D(0, page->TextureHandle);
+		glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, width, height, GL_BGRA, GL_UNSIGNED_BYTE, bits);
+
+		float pageSize = (float)atlas->PageSize;
+
+		texture.TextureHandle = page->TextureHandle;
+		texture.Width = width;
+		texture.Height = height;
+		texture.Region = vec4f(x / pageSize, y / pageSize, width / pageSize, height / pageSize);
+		texture.Packed = true;
+	}
+	else
+	{
+		texture = CreateTexture(width, height, bits);
+	}
+
+	FreeImage_Unload(dib);
+
+	FreeImage_DeInitialise();
+
+	return texture;
+}
+
+void DestroyAtlas(TextureAtlas *atlas)
+{
+	for (uint32 i = 0; i < atlas->Pages.size(); i++)
+	{
+		DeleteTexture(&atlas->Pages[i].TextureHandle);
+	}
+
+	atlas->Pages.clear();
+}
@@ -0,0 +1,123 @@
+#include <TileCollider.h>
+#include <SceneManager.h>
+#include <math.h>
+
+TileCollider::TileCollider(char *name, char *path, vec2f tileSize, uint32 solidCodes)
+{
+	this->Type = "TILECOLLIDER";
+	this->Name = name;
+	this->Path = path;
+	this->TileSize = tileSize;
+	this->SolidCodes = solidCodes;
+	this->Origin = vec2f();
+	this->Map = NULL;
+	this->Rects = NULL;
+	this->Colliders = NULL;
+	this->Centers = NULL;
+	this->CellRects = NULL;
+	this->RectStamps = NULL;
+	this->Stamp = 0;
+	this->ProxyBase = 0;
+	this->Size = sizeof(TileCollider);
+}
+
+void TileCollider::Init()
+{
+	Map = new TileMap();
+	Rects = new std::vector<TileRect>();
+	Colliders = new std::vector<Collider>();
+	Centers = new std::vector<vec3f>();
+	CellRects = new std::vector<uint32>();
+	RectStamps = new std::vector<uint32>();
+
+	Origin = Owner->ObjectTransform.Position.XY();
+
+	if (!LoadTileMap(Path, Map))
+	{
+		return;
+	}
+
+	MergeSolidTiles(Map, SolidCodes, Rects);
+
+	CellRects->assign(Map->Width * Map->Height, TILE_NO_RECT);
+	RectStamps->assign(Rects->size(), 0);
+
+	//NOTE(kai): the colliders point into Centers, so it can't grow after this
+	Centers->reserve(Rects->size());
+	Colliders->reserve(Rects->size());
+
+	for (uint32 i = 0; i < Rects->size(); i++)
+	{
+		TileRect *rect = &(*Rects)[i];
+
+		for (uint32 y = rect->Y; y < rect->Y + rect->Height; y++)
+		{
+			for (uint32 x = rect->X; x < rect->X + rect->Width; x++)
+			{
+				(*CellRects)[y * Map->Width + x] = i;
+			}
+		}
+
+		vec2f size = vec2f(rect->Width * TileSize.X, rect->Height * TileSize.Y);
+
+		Centers->push_back(vec3f(Origin.X + rect->X * TileSize.X + size.X / 2.0f,
+								 Origin.Y - rect->Y * TileSize.Y - size.Y / 2.0f, 0.0f));
+
+		Colliders->push_back(Collider(Name, &Centers->back(), size, vec2f(), true, false));
+
+		Collider *collider = &Colliders->back();
+		collider->Scene = Scene;
+		collider->Owner = Owner;
+		collider->Init();
+	}
+
+	Scene->PEngine.AddTileCollider(this);
+}
+
+void TileCollider::Destroy()
+{
+	Scene->PEngine.RemoveTileCollider(this);
+
+	delete Map;
+	delete Rects;
+	delete Colliders;
+	delete Centers;
+	delete CellRects;
+	delete RectStamps;
+}
+
+void TileCollider::FindRects(float minX, float minY, float maxX, float maxY, std::vector<uint32> *result)
+{
+	if (!Map->Width || Rects->empty())
+	{
+		return;
+	}
+
+	//NOTE(kai): rows go down the map while Y goes up the screen
+	int32 firstX = (int32)floorf((minX - Origin.X) / TileSize.X);
+	int32 lastX = (int32)floorf((maxX - Origin.X) / TileSize.X);
+	int32 firstY = (int32)floorf((Origin.Y - maxY) / TileSize.Y);
+	int32 lastY = (int32)floorf((Origin.Y - minY) / TileSize.Y);
+
+	firstX = max(firstX, 0);
+	firstY = max(firstY, 0);
+	lastX = min(lastX, (int32)Map->Width - 1);
+	lastY = min(lastY, (int32)Map->Height - 1);
+
+	//NOTE(kai): a big rect covers many cells, the stamp makes sure it's only reported once per call
+	Stamp++;
+
+	for (int32 y = firstY; y <= lastY; y++)
+	{
+		for (int32 x = firstX; x <= lastX; x++)
+		{
+			uint32 rect = (*CellRects)[y * Map->Width + x];
+
+			if (rect != TILE_NO_RECT && (*RectStamps)[rect] != Stamp)
+			{
+				(*RectStamps)[rect] = Stamp;
+				result->push_back(rect);
+			}
+		}
+	}
+}
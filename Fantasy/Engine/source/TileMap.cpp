@@ -0,0 +1,179 @@
+#include <TileMap.h>
+#include <Utilities.h>
+
+file_internal bool LoadBinaryTileMap(DataFile *file, TileMap *map)
+{
+	TileMapHeader *header = (TileMapHeader *)file->Data;
+	uint64 count = (uint64)header->Width * header->Height;
+
+	if (!count || file->Length - sizeof(TileMapHeader) < count)
+	{
+		return false;
+	}
+
+	uint8 *codes = (uint8 *)file->Data + sizeof(TileMapHeader);
+
+	map->Width = header->Width;
+	map->Height = header->Height;
+	map->Tiles.assign(codes, codes + count);
+
+	return true;
+}
+
+bool LoadTileMap(char *path, TileMap *map)
+{
+	DataFile file = {};
+
+	LoadFile(path, &file);
+
+	map->Width = 0;
+	map->Height = 0;
+	map->Tiles.clear();
+
+	if (!file.Data || !file.Length)
+	{
+		std::cout << "Couldn't load tile map " << path << std::endl;
+		UnloadFile(&file);
+
+		return false;
+	}
+
+	if (file.Length >= sizeof(TileMapHeader) && ((TileMapHeader *)file.Data)->Magic == TILE_MAP_MAGIC)
+	{
+		bool loaded = LoadBinaryTileMap(&file, map);
+
+		UnloadFile(&file);
+
+		if (!loaded)
+		{
+			std::cout << "Tile map " << path << " is shorter than its header says" << std::endl;
+		}
+
+		return loaded;
+	}
+
+	char *text = (char *)file.Data;
+	uint32 rowLength = 0;
+	bool valid = true;
+
+	//NOTE(kai): one extra pass at the end closes a last row that has no line break
+	for (uint32 i = 0; i <= file.Length; i++)
+	{
+		char c = i < file.Length ? text[i] : '\n';
+
+		if (c >= '0' && c <= '9')
+		{
+			map->Tiles.push_back((uint8)(c - '0'));
+			rowLength++;
+		}
+		else if (c == '\n' && rowLength)
+		{
+			if (!map->Width)
+			{
+				map->Width = rowLength;
+			}
+			else if (rowLength != map->Width)
+			{
+				valid = false;
+			}
+
+			map->Height++;
+			rowLength = 0;
+		}
+	}
+
+	UnloadFile(&file);
+
+	if (!valid || !map->Width)
+	{
+		std::cout << "Tile map " << path << " doesn't have rows of the same length" << std::endl;
+
+		map->Width = 0;
+		map->Height = 0;
+		map->Tiles.clear();
+
+		return false;
+	}
+
+	return true;
+}
+
+uint8 GetTile(TileMap *map, uint32 x, uint32 y)
+{
+	if (x >= map->Width || y >= map->Height)
+	{
+		return 0;
+	}
+
+	return map->Tiles[y * map->Width + x];
+}
+
+bool IsSolidTile(TileMap *map, uint32 x, uint32 y, uint32 solidCodes)
+{
+	if (x >= map->Width || y >= map->Height)
+	{
+		return false;
+	}
+
+	//NOTE(kai): binary maps can hold codes past the mask, those are never solid
+	uint8 code = GetTile(map, x, y);
+
+	return code < 32 && (solidCodes & (1u << code)) != 0;
+}
+
+void MergeSolidTiles(TileMap *map, uint32 solidCodes, std::vector<TileRect> *rects)
+{
+	std::vector<uint8> used(map->Width * map->Height, 0);
+
+	rects->clear();
+
+	for (uint32 y = 0; y < map->Height; y++)
+	{
+		for (uint32 x = 0; x < map->Width; x++)
+		{
+			if (used[y * map->Width + x] || !IsSolidTile(map, x, y, solidCodes))
+			{
+				continue;
+			}
+
+			uint32 width = 1;
+
+			while (x + width < map->Width && !used[y * map->Width + x + width]
+				   && IsSolidTile(map, x + width, y, solidCodes))
+			{
+				width++;
+			}
+
+			uint32 height = 1;
+
+			for (; y + height < map->Height; height++)
+			{
+				bool solidRow = true;
+
+				for (uint32 i = x; i < x + width; i++)
+				{
+					if (used[(y + height) * map->Width + i] || !IsSolidTile(map, i, y + height, solidCodes))
+					{
+						solidRow = false;
+						break;
+					}
+				}
+
+				if (!solidRow)
+				{
+					break;
+				}
+			}
+
+			for (uint32 j = y; j < y + height; j++)
+			{
+				for (uint32 i = x; i < x + width; i++)
+				{
+					used[j * map->Width + i] = 1;
+				}
+			}
+
+			rects->push_back(TileRect{ x, y, width, height });
+		}
+	}
+}
@@ -0,0 +1,204 @@
+#include <TileMapRenderer.h>
+
+TileMapRenderer::TileMapRenderer(char *name, char *path, vec2f tileSize, Texture tileset, uint32 tilesetColumns, uint32 tilesetRows)
+{
+	this->Type = "TILEMAP";
+	this->Name = name;
+	this->Path = path;
+	this->TileSize = tileSize;
+	this->Origin = vec2f();
+	this->Tileset = tileset;
+	this->TilesetColumns = tilesetColumns;
+	this->TilesetRows = tilesetRows;
+	this->Map = NULL;
+	this->ChunksX = 0;
+	this->ChunksY = 0;
+	this->Chunks = NULL;
+	this->Indices = {};
+	this->Size = sizeof(TileMapRenderer);
+}
+
+void TileMapRenderer::Init()
+{
+	Map = new TileMap();
+	Chunks = new std::vector<TileChunk>();
+
+	Origin = Owner->ObjectTransform.Position.XY();
+
+	if (!LoadTileMap(Path, Map))
+	{
+		return;
+	}
+
+	ChunksX = (Map->Width + TILE_CHUNK_SIZE - 1) / TILE_CHUNK_SIZE;
+	ChunksY = (Map->Height + TILE_CHUNK_SIZE - 1) / TILE_CHUNK_SIZE;
+
+	Chunks->resize(ChunksX * ChunksY);
+
+	for (uint32 y = 0; y < ChunksY; y++)
+	{
+		for (uint32 x = 0; x < ChunksX; x++)
+		{
+			TileChunk *chunk = &(*Chunks)[y * ChunksX + x];
+
+			uint32 lastX = min((x + 1) * TILE_CHUNK_SIZE, Map->Width);
+			uint32 lastY = min((y + 1) * TILE_CHUNK_SIZE, Map->Height);
+
+			//NOTE(kai): rows go down the map while Y goes up the screen
+			chunk->Bounds = BoundingRect{ Origin.X + x * TILE_CHUNK_SIZE * TileSize.X, Origin.Y - lastY * TileSize.Y
+				, Origin.X + lastX * TileSize.X, Origin.Y - y * TILE_CHUNK_SIZE * TileSize.Y };
+			chunk->Dirty = true;
+		}
+	}
+
+	ReserveQuadIndices(&Indices, TILE_CHUNK_SIZE * TILE_CHUNK_SIZE, false);
+}
+
+void TileMapRenderer::Destroy()
+{
+	for (uint32 i = 0; i < Chunks->size(); i++)
+	{
+		TileChunk *chunk = &(*Chunks)[i];
+
+		DeleteBuffer(&chunk->VBO);
+	}
+
+	DeleteBuffer(&Indices.Handle);
+
+	delete Map;
+	delete Chunks;
+}
+
+void TileMapRenderer::SetTile(uint32 x, uint32 y, uint8 code)
+{
+	if (!Map || x >= Map->Width || y >= Map->Height)
+	{
+		return;
+	}
+
+	Map->Tiles[y * Map->Width + x] = code;
+
+	(*Chunks)[(y / TILE_CHUNK_SIZE) * ChunksX + x / TILE_CHUNK_SIZE].Dirty = true;
+}
+
+file_internal void BuildChunk(TileMapRenderer *renderer, uint32 chunkX, uint32 chunkY, std::vector<SpriteVertex> *vertices)
+{
+	TileMap *map = renderer->Map;
+	TileChunk *chunk = &(*renderer->Chunks)[chunkY * renderer->ChunksX + chunkX];
+
+	uint32 firstX = chunkX * TILE_CHUNK_SIZE;
+	uint32 firstY = chunkY * TILE_CHUNK_SIZE;
+	uint32 lastX = min(firstX + TILE_CHUNK_SIZE, map->Width);
+	uint32 lastY = min(firstY + TILE_CHUNK_SIZE, map->Height);
+
+	uint32 columns = renderer->TilesetColumns;
+	uint32 rows = renderer->TilesetRows;
+
+	//NOTE(kai): the tileset may be packed into an atlas page, the cells are cut from its region
+	vec4f region = TextureRegionUV(&renderer->Tileset, vec4f(0, 0, 1, 1));
+	float cellWidth = region.Z / (float)columns;
+	float cellHeight = region.W / (float)rows;
+
+	vec2f origin = renderer->Origin;
+	vec2f tileSize = renderer->TileSize;
+
+	vertices->clear();
+
+	for (uint32 y = firstY; y < lastY; y++)
+	{
+		for (uint32 x = firstX; x < lastX; x++)
+		{
+			uint8 code = GetTile(map, x, y);
+
+			if (code == TILE_EMPTY || code >= columns * rows)
+			{
+				continue;
+			}
+
+			uint32 col = code % columns;
+			uint32 row = (rows - 1) - (code / columns);
+
+			uint16 u0 = ToUnorm16(region.X + col * cellWidth);
+			uint16 u1 = ToUnorm16(region.X + (col + 1) * cellWidth);
+			uint16 v0 = ToUnorm16(region.Y + row * cellHeight);
+			uint16 v1 = ToUnorm16(region.Y + (row + 1) * cellHeight);
+
+			float left = origin.X + x * tileSize.X;
+			float right = left + tileSize.X;
+			float top = origin.Y - y * tileSize.Y;
+			float bottom = top - tileSize.Y;
+
+			SpriteVertex quad[4] =
+			{
+				{ { left, bottom }, { u0, v0 }, { 255, 255, 255, 255 } },
+				{ { left, top }, { u0, v1 }, { 255, 255, 255, 255 } },
+				{ { right, top }, { u1, v1 }, { 255, 255, 255, 255 } },
+				{ { right, bottom }, { u1, v0 }, { 255, 255, 255, 255 } },
+			};
+
+			vertices->insert(vertices->end(), quad, quad + 4);
+		}
+	}
+
+	chunk->QuadCount = (uint32)vertices->size() / 4;
+	chunk->Dirty = false;
+
+	//NOTE(kai): a snapshot the render thread hasn't finished may still draw the old buffer, so a rebuild never
+	//			 writes into it. it gets a fresh one and the old one waits in the deferred deletes
+	if (chunk->VBO)
+	{
+		DeleteBuffer(&chunk->VBO);
+	}
+
+	if (!chunk->QuadCount)
+	{
+		return;
+	}
+
+	glGenBuffers(1, &chunk->VBO);
+
+	BindBuffer(GL_ARRAY_BUFFER, chunk->VBO);
+	glBufferData(GL_ARRAY_BUFFER, vertices->size() * sizeof(SpriteVertex), vertices->data(), GL_STATIC_DRAW);
+}
+
+uint32 CollectTileChunks(TileMapRenderer *renderer, BoundingRect *view, std::vector<SnapshotChunk> *chunks, uint32 *culled)
+{
+	if (!renderer->Chunks || renderer->Chunks->empty())
+	{
+		return 0;
+	}
+
+	uint32 visible = 0;
+	std::vector<SpriteVertex> vertices;
+
+	for (uint32 y = 0; y < renderer->ChunksY; y++)
+	{
+		for (uint32 x = 0; x < renderer->ChunksX; x++)
+		{
+			TileChunk *chunk = &(*renderer->Chunks)[y * renderer->ChunksX + x];
+
+			if (!RectsOverlap(&chunk->Bounds, view))
+			{
+				(*culled)++;
+				continue;
+			}
+
+			//NOTE(kai): a dirty chunk off screen waits until it shows up again
+			if (chunk->Dirty)
+			{
+				BuildChunk(renderer, x, y, &vertices);
+			}
+
+			visible++;
+
+			if (!chunk->QuadCount)
+			{
+				continue;
+			}
+
+			chunks->push_back(SnapshotChunk{ chunk->VBO, renderer->Indices.Handle, chunk->QuadCount, renderer->Tileset.TextureHandle });
+		}
+	}
+
+	return visible;
+}
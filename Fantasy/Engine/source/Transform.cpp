@@ -1,3 +1,4 @@
+#include <float.h>
 #include "Transform.h"
 
 void Transform::Update()
@@ -116,6 +117,20 @@ mat4f CalcProjection(BasicCamera *cam)
 	return result;
 }
 
+BoundingRect CalcViewRect(BasicCamera *cam)
+{
+	if (cam->Type != CameraType::ORTHOGRAPHIC)
+	{
+		return BoundingRect{ -FLT_MAX, -FLT_MAX, FLT_MAX, FLT_MAX };
+	}
+
+	//NOTE(kai): the view matrix scales after moving to the eye, so a bigger Scale shows less of the world
+	float halfWidth = (cam->Size.X / 2.0f) / fabsf(cam->Scale.X);
+	float halfHeight = (cam->Size.Y / 2.0f) / fabsf(cam->Scale.Y);
+
+	return BoundingRect{ cam->Eye.X - halfWidth, cam->Eye.Y - halfHeight, cam->Eye.X + halfWidth, cam->Eye.Y + halfHeight };
+}
+
 mat4f CalcMVP(Transform *transform, BasicCamera *cam)
 {
 	return CalcProjection(cam) * CalcLookAtViewMatrix(cam) * CalcModelMatrix(transform);
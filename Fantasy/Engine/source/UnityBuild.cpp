@@ -11,4 +11,20 @@
 #include "Shader.cpp"
 #include "Texture.cpp"
 #include "Transform.cpp"
-#include "Animator.cpp"
\ No newline at end of file
+#include "Animator.cpp"
+#include "Broadphase.cpp"
+#include "CollisionBatch.cpp"
+#include "JobSystem.cpp"
+#include "TileMap.cpp"
+#include "TileCollider.cpp"
+#include "SpriteBatch.cpp"
+#include "StreamBuffer.cpp"
+#include "TextureAtlas.cpp"
+#include "RenderQueue.cpp"
+#include "AnimationSystem.cpp"
+#include "GLState.cpp"
+#include "VertexFormat.cpp"
+#include "TileMapRenderer.cpp"
+#include "ParallaxLayer.cpp"
+#include "RenderSnapshot.cpp"
+#include "GpuTimer.cpp"
\ No newline at end of file
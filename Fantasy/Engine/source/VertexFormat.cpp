@@ -0,0 +1,59 @@
+#include <VertexFormat.h>
+
+file_internal VertexFormat MeshVertexFormat =
+{
+	sizeof(Vertex),
+	5,
+	{
+		{ "position", 3, GL_FLOAT, false, offsetof(Vertex, Pos) },
+		{ "inputTexCoords", 2, GL_FLOAT, false, offsetof(Vertex, TexCoords) },
+		{ "color", 4, GL_FLOAT, false, offsetof(Vertex, Color) },
+		{ "slot", 1, GL_FLOAT, false, offsetof(Vertex, TextureSlot) },
+		{ "normal", 3, GL_FLOAT, false, offsetof(Vertex, Normal) },
+	},
+};
+
+file_internal VertexFormat SpriteVertexFormat =
+{
+	sizeof(SpriteVertex),
+	3,
+	{
+		{ "position", 2, GL_FLOAT, false, offsetof(SpriteVertex, Pos) },
+		{ "inputTexCoords", 2, GL_UNSIGNED_SHORT, true, offsetof(SpriteVertex, TexCoords) },
+		{ "color", 4, GL_UNSIGNED_BYTE, true, offsetof(SpriteVertex, Color) },
+	},
+};
+
+VertexFormat* GetMeshVertexFormat()
+{
+	return &MeshVertexFormat;
+}
+
+VertexFormat* GetSpriteVertexFormat()
+{
+	return &SpriteVertexFormat;
+}
+
+void SetVertexAttributes(VertexFormat *format, uint32 baseOffset)
+{
+	uint8 *base = (uint8 *)0 + baseOffset;
+
+	for (uint32 i = 0; i < format->AttributeCount; i++)
+	{
+		VertexAttribute *attribute = &format->Attributes[i];
+
+		glEnableVertexAttribArray(i);
+		glVertexAttribPointer(i
+			, attribute->Components
+			, attribute->Type
+			, attribute->Normalized ? GL_TRUE : GL_FALSE
+			, format->Stride
+			, base + attribute->Offset);
+	}
+
+	//NOTE(kai): without vertex arrays the last format's extra arrays would still be enabled and read past the buffer
+	for (uint32 i = format->AttributeCount; i < VERTEX_FORMAT_MAX_ATTRIBUTES; i++)
+	{
+		glDisableVertexAttribArray(i);
+	}
+}
@@ -68,5 +68,7 @@ public:
 	GameObject *Attack;
 	GameObject *AttackAdvance;
 	GameObject *player;
+	Collider *target;
+	uint32 targetLayer;
 	GameObject *me;
 };
@@ -61,6 +61,8 @@ public:
 	GameObject *HpBar;
 	GameObject *Attack;
 	GameObject *player;
+	Collider *target;
+	uint32 targetLayer;
 	GameObject *me;
 
 };
\ No newline at end of file
@@ -67,5 +67,7 @@ public:
 	GameObject *HpBar;
 	GameObject *Attack;
 	GameObject *player;
+	Collider *target;
+	uint32 targetLayer;
 	GameObject *me;
 };
@@ -8,7 +8,7 @@
 #include <PlayerMove.h>
 #include <Collider.h>
 #include <ArcMonster.h>
-#include <Tilling.h>
+#include <ParallaxLayer.h>
 #include <BasicAttack.h>
 #include <StraightMonster.h>
 #include <PullBackMonster.h>
@@ -13,40 +13,20 @@ void ApplyGravity :: Init()
 
 	this->fallSpeed = 0.0f;
 
+	//NOTE(kai): the physics engine does the falling now, this used to add Gravity * 25 a tick
+	Collider *collider = (Collider *)Owner->GetComponent(colliderName, "COLLIDER");
 
+	if (collider)
+	{
+		collider->dynamic = true;
+		collider->useGravity = true;
+		collider->gravityScale = 2.5f;
+	}
 }
 
 void  ApplyGravity::Update(float delta, Game_Input *input)
 {
-	bool groundCheck = false;
-	bool Jump;
 	Collider *collider = (Collider *)Owner->GetComponent(colliderName, "COLLIDER");
 
-	Jump = collider->jump;
-
-	if (Jump)
-	{
-
-		groundCheck = true;
-
-	}
-
-	if (groundCheck)
-	{
-		//Jump = true;
-		fallSpeed = 0;
-		collider->velocity.Y = 0;
-
-	}
-
-	else if (!groundCheck)
-	{
-
-		fallSpeed += (collider->Scene->PEngine.ph.Gravity*delta*25.0f);
-
-		Owner->ObjectTransform.Position.Y -= fallSpeed;
-		//Game_Scene.CollisionManager.GetCollider(ActorName)->pos->Y -= fallSpeed;
-		collider->velocity.Y = -fallSpeed;
-
-	}
+	fallSpeed = collider->jump ? 0.0f : -collider->linearVelocity.Y * delta;
 }
\ No newline at end of file
@@ -11,7 +11,7 @@ ArcMonster::ArcMonster(char *name, Game_Resources *resources)
 
 void ArcMonster::Init()
 {
-	AddTexture(Resources, LoadTexture("resources\\textures\\yellow.png"), "ArcMonster");
+	AddTexture(Resources, LoadAtlasTexture(&Resources->Atlas, "resources\\textures\\yellow.png"), "ArcMonster");
 
 }
 
@@ -54,6 +54,7 @@ void ArcMonster::Update(float delta, Game_Input *input)
 				arcMon_hideFlag = false;
 				PlayerCollide->playerHp -= 20;
 				arcMonster = this->Scene->AddObject("ArcMonster");
+				arcMonster->Layer = "playerAttack";
 				arcMonster->ObjectTransform.Position = Owner->ObjectTransform.Position;
 				arcMonster->AddComponent(&SpriteRenderer("ArcMonster_sprite", Sprite{ vec3f(0, 0, 0), vec2f(300*2.5f, 266*1.5f), Material{ GetTexture(Resources, "arc_Mon"), vec4f(1, 1, 1, 1) } }));
 				arcMonster->ObjectTransform.Position.X = Owner->ObjectTransform.Position.X + 50 * Owner->ObjectTransform.Scale.X;
@@ -63,6 +64,7 @@ void ArcMonster::Update(float delta, Game_Input *input)
 				y_ArcVelo = cos(arcMonDirection*PI / 180)*arcMonStrenght;
 				diro = Owner->ObjectTransform.Scale.X;
 				arcMonster->AddComponent(&Collider("arc", &arcMonster->ObjectTransform.Position, vec2f(300, 266), vec2f(0, 0), 0, true));
+				((Collider *)arcMonster->GetComponent("arc", "COLLIDER"))->continuous = true;
 				arcMonster->AddComponent(&Animator("animator", (SpriteRenderer *)arcMonster->GetComponent("ArcMonster_sprite", "RENDERABLE")));
 				//	Game_Scene.ActorManager.GetTransform("straight_Mon")->Position = vec3f(200.0f, -200.0f, 0);
 				Animator *animator = (Animator *)arcMonster->GetComponent("animator", "ANIMATOR");
@@ -11,7 +11,7 @@ BasicAttack::BasicAttack(char *name, Game_Resources *resources)
 
 void BasicAttack::Init()
 {
-	AddTexture(Resources, LoadTexture("resources\\textures\\yellow.png"), "ArcMonster");
+	AddTexture(Resources, LoadAtlasTexture(&Resources->Atlas, "resources\\textures\\yellow.png"), "ArcMonster");
 
 }
 
@@ -39,6 +39,7 @@ void BasicAttack::Update(float delta, Game_Input *input)
 	if (fireAttackCollisionL)
 	{
 		basicAttack = this->Scene->AddObject("playerBasicAttack");
+		basicAttack->Layer = "playerAttack";
 		basicAttack->ObjectTransform.Position = Owner->ObjectTransform.Position;
 		//basicAttack->AddComponent(&SpriteRenderer("basicAttack_sprite", Sprite{ vec3f(0, 0, 0), vec2f(50, 100), Material{ GetTexture(Resources, "ArcMonster"), vec4f(1, 1, 1, 1) } }));
 		basicAttack->AddComponent(&Collider("basic", &basicAttack->ObjectTransform.Position, vec2f(10, 200), vec2f(0, 0), 0, false));
@@ -57,6 +58,7 @@ void BasicAttack::Update(float delta, Game_Input *input)
 	if (fireAttackCollisionR)
 	{
 		basicAttack = this->Scene->AddObject("playerBasicAttack");
+		basicAttack->Layer = "playerAttack";
 		basicAttack->ObjectTransform.Position = Owner->ObjectTransform.Position;
 		//basicAttack->AddComponent(&SpriteRenderer("basicAttack_sprite", Sprite{ vec3f(0, 0, 0), vec2f(50, 100), Material{ GetTexture(Resources, "ArcMonster"), vec4f(1, 1, 1, 1) } }));
 		basicAttack->AddComponent(&Collider("basic", &basicAttack->ObjectTransform.Position, vec2f(10, 200), vec2f(0, 0), 0, true));
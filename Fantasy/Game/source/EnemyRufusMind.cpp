@@ -30,12 +30,13 @@ EnemyRufusMind::EnemyRufusMind(char* comName, Game_Resources *resources, char* n
 void EnemyRufusMind::Init()
 {
 	player = this->Scene->GetGameObject("player");
+	targetLayer = Scene->PEngine.AddLayer("player");
 	me = this->Scene->GetGameObject(myName);
 	me->ObjectTransform.Position = myPos;
 
 
 	HpBar = this->Scene->AddObject(myHbBarName);
-	HpBar->AddComponent(&SpriteRenderer("HpBar_sprite", Sprite{ vec3f(0, 0, 0), vec2f(150, 25), Material{ GetTexture(Resources, "Empty"), vec4f(0, 1, .5, 1) } }));
+	HpBar->AddComponent(&SpriteRenderer("HpBar_sprite", Sprite{ vec3f(0, 0, 0), vec2f(150, 25), Material{ GetTexture(Resources, "Empty"), vec4f(0, 1, .5, 1) } }, RENDER_LAYER_WORLD + 1));
 	HpBar->ObjectTransform.Position = myPos;
 	HpBar->ObjectTransform.Position.Y += 200;
 	}
@@ -140,7 +141,7 @@ void EnemyRufusMind::Update(float delta, Game_Input *input)
 	if (fireAttackCollisionL)
 	{
 		Attack = this->Scene->AddObject(myAttackName);
-		AttackAdvance->Layer = "rufusBasicAttack";
+		Attack->Layer = "rufusBasicAttack";
 		Attack->ObjectTransform.Position = me->ObjectTransform.Position;
 		Attack->AddComponent(&Collider("cp", &Attack->ObjectTransform.Position, vec2f(500, 100), vec2f(0, 0), false, true));
 		Attack->ObjectTransform.Position.X -= 140;
@@ -156,7 +157,7 @@ void EnemyRufusMind::Update(float delta, Game_Input *input)
 	if (fireAttackCollisionR)
 	{
 		Attack = this->Scene->AddObject(myAttackName);
-		AttackAdvance->Layer = "rufusBasicAttack";
+		Attack->Layer = "rufusBasicAttack";
 		Attack->ObjectTransform.Position = me->ObjectTransform.Position;
 		Attack->AddComponent(&Collider("cp", &Attack->ObjectTransform.Position, vec2f(500, 100), vec2f(0, 0), false, true));
 		Attack->ObjectTransform.Position.X -= 140;
@@ -176,13 +177,17 @@ void EnemyRufusMind::Update(float delta, Game_Input *input)
 	//else play the logic
 	else{
 		//if the player in see range 
-		if (std::abs(player->ObjectTransform.Position.X - me->ObjectTransform.Position.X) < seeRange)
+		//NOTE(kai): ask the physics engine who's in sight instead of measuring the player by hand
+		target = Scene->PEngine.Nearest(vec2f(me->ObjectTransform.Position.X, me->ObjectTransform.Position.Y), seeRange, targetLayer,
+											(Collider*)me->GetComponent(myColliderName, "COLLIDER"));
+
+		if (target)
 		{
 			//if the player in Attack range 
-			if (std::abs(player->ObjectTransform.Position.X - me->ObjectTransform.Position.X) < attackRange)
+			if (std::abs(target->pos->X - me->ObjectTransform.Position.X) < attackRange)
 			{
 				//player in attack range from left
-				if (player->ObjectTransform.Position.X  < me->ObjectTransform.Position.X)
+				if (target->pos->X < me->ObjectTransform.Position.X)
 				{
 					me->ObjectTransform.Scale.X = -1;
 
@@ -207,7 +212,7 @@ void EnemyRufusMind::Update(float delta, Game_Input *input)
 				}
 			}
 			//Player in see range from left
-			else if (player->ObjectTransform.Position.X < me->ObjectTransform.Position.X)
+			else if (target->pos->X < me->ObjectTransform.Position.X)
 			{
 				int randomNum;
 				randomNum = std::rand() % 1000;
@@ -279,7 +284,7 @@ void EnemyRufusMind::Update(float delta, Game_Input *input)
 		//EditSprite(&Scene->RendererManager.GetRenderable(myName, RenderableType::Movable)->Buffers, vec3f(), Scene->RendererManager.GetRenderable(myName, RenderableType::Movable)->Size, (.5, 1, 1, 1)); 
 		s = (SpriteRenderer*)Owner->GetComponent(mySpriteName, "RENDERABLE");
 
-		EditSprite(&s->SpriteData.Buffers, s->SpriteData.Pos, s->SpriteData.Size, vec4f(1, 1, 1, 0.3));
+		EditSprite(&s->SpriteData, vec4f(1, 1, 1, 0.3));
 
 	}
 
@@ -298,7 +303,7 @@ void EnemyRufusMind::Update(float delta, Game_Input *input)
 				//EditSprite(&Scene->RendererManager.GetRenderable(myName, RenderableType::Movable)->Buffers, vec3f(), Scene->RendererManager.GetRenderable(myName, RenderableType::Movable)->Size, (1, .5, .5, 1));
 				s = (SpriteRenderer*)Owner->GetComponent(mySpriteName, "RENDERABLE");
 
-				EditSprite(&s->SpriteData.Buffers, s->SpriteData.Pos, s->SpriteData.Size, vec4f(1, 1, 1, 0.8));
+				EditSprite(&s->SpriteData, vec4f(1, 1, 1, 0.8));
 
 			}
 			else if ((ownerCollider->checkObjectCollision())[i] == "straightMonster"){
@@ -310,7 +315,7 @@ void EnemyRufusMind::Update(float delta, Game_Input *input)
 				holdColide = true;
 				s = (SpriteRenderer*)Owner->GetComponent(mySpriteName, "RENDERABLE");
 
-				EditSprite(&s->SpriteData.Buffers, s->SpriteData.Pos, s->SpriteData.Size, vec4f(1, 1, 1, 0.8));
+				EditSprite(&s->SpriteData, vec4f(1, 1, 1, 0.8));
 
 			}
 			else if ((ownerCollider->checkObjectCollision())[i] == "ArcMonster"){
@@ -319,7 +324,7 @@ void EnemyRufusMind::Update(float delta, Game_Input *input)
 				holdColide = true;
 				s = (SpriteRenderer*)Owner->GetComponent(mySpriteName, "RENDERABLE");
 
-				EditSprite(&s->SpriteData.Buffers, s->SpriteData.Pos, s->SpriteData.Size, vec4f(1, 1, 1, 0.8));
+				EditSprite(&s->SpriteData, vec4f(1, 1, 1, 0.8));
 
 			}
 		}
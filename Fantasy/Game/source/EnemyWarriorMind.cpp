@@ -29,13 +29,14 @@ EnemyWarriorMind::EnemyWarriorMind(char* comName, Game_Resources *resources, cha
 void EnemyWarriorMind::Init()
 {
 	player = this->Scene->GetGameObject("player");
+	targetLayer = Scene->PEngine.AddLayer("player");
 	me = this->Scene->GetGameObject(myName);
 	me->ObjectTransform.Position = myPos;
 
 	HpBar = this->Scene->AddObject(myHbBarName);
 	HpBar->ObjectTransform.Position = myPos;
 	HpBar->ObjectTransform.Position.Y += 200;
-	HpBar->AddComponent(&SpriteRenderer("HpBar_sprite", Sprite{ vec3f(0, 0, 0), vec2f(150, 25), Material{ GetTexture(Resources, "Empty"), vec4f(0, 1, .5, 1) } }));
+	HpBar->AddComponent(&SpriteRenderer("HpBar_sprite", Sprite{ vec3f(0, 0, 0), vec2f(150, 25), Material{ GetTexture(Resources, "Empty"), vec4f(0, 1, .5, 1) } }, RENDER_LAYER_WORLD + 1));
 }
 
  void EnemyWarriorMind::Update(float delta, Game_Input *input)
@@ -126,13 +127,17 @@ void EnemyWarriorMind::Init()
 	else{
 		//if the player in see range 
 
-		if (std::abs(player->ObjectTransform.Position.X - me->ObjectTransform.Position.X) < seeRange)
+		//NOTE(kai): ask the physics engine who's in sight instead of measuring the player by hand
+		target = Scene->PEngine.Nearest(vec2f(me->ObjectTransform.Position.X, me->ObjectTransform.Position.Y), seeRange, targetLayer,
+											(Collider*)me->GetComponent(myColliderName, "COLLIDER"));
+
+		if (target)
 		{
 			//if the player in Attack range 
-			if (std::abs(player->ObjectTransform.Position.X - me->ObjectTransform.Position.X) < attackRange)
+			if (std::abs(target->pos->X - me->ObjectTransform.Position.X) < attackRange)
 			{
 				//player in attack range from left
-				if (player->ObjectTransform.Position.X < me->ObjectTransform.Position.X)
+				if (target->pos->X < me->ObjectTransform.Position.X)
 				{
 					me->ObjectTransform.Scale.X = -1;
 
@@ -158,7 +163,7 @@ void EnemyWarriorMind::Init()
 				}
 			}
 			//Player in see range from left
-			else if (player->ObjectTransform.Position.X < me->ObjectTransform.Position.X)
+			else if (target->pos->X < me->ObjectTransform.Position.X)
 			{
 				me->ObjectTransform.Scale.X = -1;
 				me->ObjectTransform.Position.X -= 3;
@@ -212,7 +217,7 @@ void EnemyWarriorMind::Init()
 		//Scene->RendererManager.GetRenderable(myName, RenderableType::Movable)->RenderableMaterial.MeshColor = vec4f(1, 1, 1, 1);
 		s = (SpriteRenderer*)Owner->GetComponent(mySpriteName, "RENDERABLE");
 
-		EditSprite(&s->SpriteData.Buffers, s->SpriteData.Pos, s->SpriteData.Size, vec4f(1, 1, 1, 0.3));
+		EditSprite(&s->SpriteData, vec4f(1, 1, 1, 0.3));
 
 	}
 
@@ -232,7 +237,7 @@ void EnemyWarriorMind::Init()
 				//EditSprite(&Scene->RendererManager.GetRenderable(myName, RenderableType::Movable)->Buffers, vec3f(), Scene->RendererManager.GetRenderable(myName, RenderableType::Movable)->Size, (1, .5, .5, 1));
 				s = (SpriteRenderer*)Owner->GetComponent(mySpriteName, "RENDERABLE");
 
-				EditSprite(&s->SpriteData.Buffers, s->SpriteData.Pos, s->SpriteData.Size, vec4f(1, 1, 1, 0.3));
+				EditSprite(&s->SpriteData, vec4f(1, 1, 1, 0.3));
 			}
 			
 			else if (ownerCollider->checkObjectCollision()[i] == "straightMonster"){
@@ -245,7 +250,7 @@ void EnemyWarriorMind::Init()
 
 				s = (SpriteRenderer*)Owner->GetComponent(mySpriteName, "RENDERABLE");
 				
-				EditSprite(&s->SpriteData.Buffers, s->SpriteData.Pos, s->SpriteData.Size, vec4f(1, 1, 1, 0.3));
+				EditSprite(&s->SpriteData, vec4f(1, 1, 1, 0.3));
 			}
 			else if (ownerCollider->checkObjectCollision()[i] == "ArcMonster"){
 				// do......
@@ -255,7 +260,7 @@ void EnemyWarriorMind::Init()
 				s->SpriteData.Skin.MeshColor = vec4f(1, 1, 1, .3);*/
 				s = (SpriteRenderer*)Owner->GetComponent(mySpriteName, "RENDERABLE");
 
-				EditSprite(&s->SpriteData.Buffers, s->SpriteData.Pos, s->SpriteData.Size, vec4f(1, 1, 1, 0.3));
+				EditSprite(&s->SpriteData, vec4f(1, 1, 1, 0.3));
 
 			}
 		}
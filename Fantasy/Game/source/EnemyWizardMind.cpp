@@ -29,13 +29,14 @@ EnemyWizardMind::EnemyWizardMind(char* comName, Game_Resources *resources, char*
 void EnemyWizardMind::Init()
 {
 	player = this->Scene->GetGameObject("player");
+	targetLayer = Scene->PEngine.AddLayer("player");
 	me = this->Scene->GetGameObject(myName);
 	me->ObjectTransform.Position = myPos;
 
 	HpBar = this->Scene->AddObject(myHbBarName);
 	HpBar->ObjectTransform.Position = myPos;
 	HpBar->ObjectTransform.Position.Y += 200;
-	HpBar->AddComponent(&SpriteRenderer("HpBar_sprite", Sprite{ vec3f(0, 0, 0), vec2f(150, 25), Material{ GetTexture(Resources, "Empty"), vec4f(0, 1, .5, 1) } }));
+	HpBar->AddComponent(&SpriteRenderer("HpBar_sprite", Sprite{ vec3f(0, 0, 0), vec2f(150, 25), Material{ GetTexture(Resources, "Empty"), vec4f(0, 1, .5, 1) } }, RENDER_LAYER_WORLD + 1));
 }
 
 void EnemyWizardMind::Update(float delta, Game_Input *input)
@@ -171,13 +172,17 @@ void EnemyWizardMind::Update(float delta, Game_Input *input)
 	//else play the logic
 	else{
 		//if the player in see range 
-		if (std::abs(player->ObjectTransform.Position.X - me->ObjectTransform.Position.X) < seeRange)
+		//NOTE(kai): ask the physics engine who's in sight instead of measuring the player by hand
+		target = Scene->PEngine.Nearest(vec2f(me->ObjectTransform.Position.X, me->ObjectTransform.Position.Y), seeRange, targetLayer,
+											(Collider*)me->GetComponent(myColliderName, "COLLIDER"));
+
+		if (target)
 		{
 			//if the player in Attack range 
-			if (std::abs(player->ObjectTransform.Position.X - me->ObjectTransform.Position.X) < attackRange)
+			if (std::abs(target->pos->X - me->ObjectTransform.Position.X) < attackRange)
 			{
 				//player in attack range from left
-				if (player->ObjectTransform.Position.X <  me->ObjectTransform.Position.X)
+				if (target->pos->X < me->ObjectTransform.Position.X)
 				{
 
 					me->ObjectTransform.Scale.X = -1;
@@ -201,7 +206,7 @@ void EnemyWizardMind::Update(float delta, Game_Input *input)
 				}
 			}
 			//Player in see range from left
-			else if (player->ObjectTransform.Position.X <  me->ObjectTransform.Position.X)
+			else if (target->pos->X < me->ObjectTransform.Position.X)
 			{
 
 				me->ObjectTransform.Scale.X = -1;
@@ -251,7 +256,7 @@ void EnemyWizardMind::Update(float delta, Game_Input *input)
 		//EditSprite(&Scene->RendererManager.GetRenderable(myName, RenderableType::Movable)->Buffers, vec3f(), Scene->RendererManager.GetRenderable(myName, RenderableType::Movable)->Size, (.5, 1, 1, 1)); 
 		s = (SpriteRenderer*)Owner->GetComponent(mySpriteName, "RENDERABLE");
 
-		EditSprite(&s->SpriteData.Buffers, s->SpriteData.Pos, s->SpriteData.Size, vec4f(1, 1, 1, 0.3));
+		EditSprite(&s->SpriteData, vec4f(1, 1, 1, 0.3));
 
 	}
 
@@ -270,7 +275,7 @@ void EnemyWizardMind::Update(float delta, Game_Input *input)
 				//EditSprite(&Scene->RendererManager.GetRenderable(myName, RenderableType::Movable)->Buffers, vec3f(), Scene->RendererManager.GetRenderable(myName, RenderableType::Movable)->Size, (1, .5, .5, 1));
 				s = (SpriteRenderer*)Owner->GetComponent(mySpriteName, "RENDERABLE");
 
-				EditSprite(&s->SpriteData.Buffers, s->SpriteData.Pos, s->SpriteData.Size, vec4f(1, 1, 1, 0.3));
+				EditSprite(&s->SpriteData, vec4f(1, 1, 1, 0.3));
 
 			}
 			else if ((ownerCollider->checkObjectCollision())[i] == "straight_Mon"){
@@ -282,7 +287,7 @@ void EnemyWizardMind::Update(float delta, Game_Input *input)
 				holdColide = true;
 				s = (SpriteRenderer*)Owner->GetComponent(mySpriteName, "RENDERABLE");
 
-				EditSprite(&s->SpriteData.Buffers, s->SpriteData.Pos, s->SpriteData.Size, vec4f(1, 1, 1, 0.3));
+				EditSprite(&s->SpriteData, vec4f(1, 1, 1, 0.3));
 
 			}
 			else if ((ownerCollider->checkObjectCollision())[i] == "arc_Mon"){
@@ -291,7 +296,7 @@ void EnemyWizardMind::Update(float delta, Game_Input *input)
 				holdColide = true;
 				s = (SpriteRenderer*)Owner->GetComponent(mySpriteName, "RENDERABLE");
 
-				EditSprite(&s->SpriteData.Buffers, s->SpriteData.Pos, s->SpriteData.Size, vec4f(1, 1, 1, 0.3));
+				EditSprite(&s->SpriteData, vec4f(1, 1, 1, 0.3));
 
 			}
 		}
@@ -43,16 +43,12 @@ void Hover::Update(float delta, Game_Input *input)
 
 	if (curr == CurrentRenderer)
 	{
-		EditSprite(&(*ButtonRenderers)[CurrentRenderer]->SpriteData.Buffers
-			, (*ButtonRenderers)[CurrentRenderer]->SpriteData.Pos
-			, (*ButtonRenderers)[CurrentRenderer]->SpriteData.Size
+		EditSprite(&(*ButtonRenderers)[CurrentRenderer]->SpriteData
 			, (*ButtonRenderers)[curr]->SpriteData.Skin.MeshColor * vec4f(0.5f, 0.5f, 0.5f, 1));
 	}
 	else
 	{
-		EditSprite(&(*ButtonRenderers)[curr]->SpriteData.Buffers
-			, (*ButtonRenderers)[curr]->SpriteData.Pos
-			, (*ButtonRenderers)[curr]->SpriteData.Size
+		EditSprite(&(*ButtonRenderers)[curr]->SpriteData
 			, (*ButtonRenderers)[curr]->SpriteData.Skin.MeshColor);
 	}
 }
@@ -71,15 +67,11 @@ void Hover::Reset()
 {
 	uint32 curr = CurrentRenderer;
 
-	EditSprite(&(*ButtonRenderers)[curr]->SpriteData.Buffers
-		, (*ButtonRenderers)[curr]->SpriteData.Pos
-		, (*ButtonRenderers)[curr]->SpriteData.Size
+	EditSprite(&(*ButtonRenderers)[curr]->SpriteData
 		, (*ButtonRenderers)[curr]->SpriteData.Skin.MeshColor);
 
 	CurrentRenderer = 0;
 
-	EditSprite(&(*ButtonRenderers)[CurrentRenderer]->SpriteData.Buffers
-		, (*ButtonRenderers)[CurrentRenderer]->SpriteData.Pos
-		, (*ButtonRenderers)[CurrentRenderer]->SpriteData.Size
+	EditSprite(&(*ButtonRenderers)[CurrentRenderer]->SpriteData
 		, (*ButtonRenderers)[curr]->SpriteData.Skin.MeshColor * vec4f(0.5f, 0.5f, 0.5f, 0.5f));
 }
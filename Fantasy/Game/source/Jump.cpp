@@ -23,6 +23,15 @@ Jump::Jump(char *name, float speed, Game_Resources *resources, char *type)
 	waitDouble = 121;
 	controlWait = 0;
 
+	//NOTE(kai): the physics engine moves the player, jumping only sets the velocity
+	Collider *collider = (Collider *)Owner->GetComponent("c1", "COLLIDER");
+
+	if (collider)
+	{
+		collider->dynamic = true;
+		collider->useGravity = true;
+	}
+
 
 }
 
@@ -64,7 +73,6 @@ Jump::Jump(char *name, float speed, Game_Resources *resources, char *type)
 		 doubleJumpFlag = false;
 		 onair = false;
 		 fallSpeed_jump = 0;
-		 collider->velocity.Y = 0;
 
 	 }
 	 Animator *animatorPlayer = (Animator *)Owner->GetComponent("animator", "ANIMATOR");
@@ -73,7 +81,8 @@ Jump::Jump(char *name, float speed, Game_Resources *resources, char *type)
 	 if (input->Space.KeyDown && groundCheck)
 	 {
 		 // reset 
-		 Speed = 17.0f;
+		 Speed = 1020.0f;
+		 collider->linearVelocity.Y = Speed;
 		 onair = true;
 		 jumpflag = true;
 		 groundCheck = false;
@@ -101,11 +110,8 @@ Jump::Jump(char *name, float speed, Game_Resources *resources, char *type)
 	 {
 		 fallSpeed_jump = 0;
 
-		 Owner->ObjectTransform.Position.Y += Speed;
 		 //	Game_Scene.CollisionManager.GetCollider(ActorName)->pos->Y += jumpSpeed;
-		 collider->velocity.Y = Speed;
-
-		 Speed -= collider->Scene->PEngine.ph.Gravity*delta * 10.0f;
+		 Speed = collider->linearVelocity.Y;
 
 		 if (Speed <= 0){
 			 if (doubleJumpFlag == true && onair == false)
@@ -115,6 +121,7 @@ Jump::Jump(char *name, float speed, Game_Resources *resources, char *type)
 				 jumbooHide_flag = false;
 				 PlayerCollide->playerHp -= 20;
 				 jumboo = this->Scene->AddObject("jumboo");
+				 jumboo->Layer = "playerAttack";
 				 jumboo->ObjectTransform.Position = Owner->ObjectTransform.Position;
 				 jumboo->ObjectTransform.Position.X -= 50.0f*Owner->ObjectTransform.Scale.X;
 				 jumboo->ObjectTransform.Position.Y -= 300.0f;
@@ -128,7 +135,8 @@ Jump::Jump(char *name, float speed, Game_Resources *resources, char *type)
 				 animator->AddClip("jumboo monster clip", &AnimationClip(GetTexture(Resources, "jumpo"), 2, 5, (1.0f / 60.0f), true));
 				 animator->StopWhenDone();
 
-				 Speed += 13.0f;
+				 Speed = 780.0f;
+				 collider->linearVelocity.Y = Speed;
 				 doubleJumpFlag = false;
 
 			 }
@@ -141,10 +149,7 @@ Jump::Jump(char *name, float speed, Game_Resources *resources, char *type)
 	 else if (!groundCheck)
 	 {
 
-		 fallSpeed_jump += (collider->Scene->PEngine.ph.Gravity*delta*10.0f);
-
-		 Owner->ObjectTransform.Position.Y -= fallSpeed_jump;
-		 collider->velocity.Y = -fallSpeed_jump;
+		 fallSpeed_jump = -collider->linearVelocity.Y * delta;
 
 	 }
  }
\ No newline at end of file
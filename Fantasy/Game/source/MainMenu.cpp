@@ -9,9 +9,9 @@ MainMenu::MainMenu(SceneManager *scene, Game_Resources *resources, char *menuRoo
 
 void MainMenu::InitMainMenu()
 {
-	AddTexture(Resources, LoadTexture("resources\\textures\\Summoner's Tale 2.png"), "back");
-	AddTexture(Resources, LoadTexture("resources\\textures\\continue.png"), "continue");
-	AddTexture(Resources, LoadTexture("resources\\textures\\exit.png"), "exit");
+	AddTexture(Resources, LoadAtlasTexture(&Resources->Atlas, "resources\\textures\\Summoner's Tale 2.png"), "back");
+	AddTexture(Resources, LoadAtlasTexture(&Resources->Atlas, "resources\\textures\\continue.png"), "continue");
+	AddTexture(Resources, LoadAtlasTexture(&Resources->Atlas, "resources\\textures\\exit.png"), "exit");
 	GameObject *currentRoot = Scene->CurrentRoot;
 
 	Scene->EnableSubRoot(MenuSubRoot);
@@ -23,19 +23,19 @@ void MainMenu::InitMainMenu()
 	*/
 	background->AddComponent(&SpriteRenderer("bg0"
 		, Sprite{ vec3f(), vec2f(2000, 1200) 
-		, Material{ GetTexture(Resources, "Empty"), vec4f(0, 0.1f, 0.3f, 1) } }));
+		, Material{ GetTexture(Resources, "Empty"), vec4f(0, 0.1f, 0.3f, 1) } }, RENDER_LAYER_BACKGROUND));
 	
 	background->AddComponent(&SpriteRenderer("bg"
 		, Sprite{ vec3f(80.0f, -15.0f), vec2f(1280, 720)
-		, Material{ GetTexture(Resources, "back"), vec4f(1, 1, 1, 1) } }));
+		, Material{ GetTexture(Resources, "back"), vec4f(1, 1, 1, 1) } }, RENDER_LAYER_BACKGROUND + 1));
 
 	newGame->AddComponent(&SpriteRenderer("new"
 		, Sprite{ vec3f(), vec2f(200, 80)
-		, Material{ GetTexture(Resources, "continue"), vec4f(1, 1, 1, 1) } }));
+		, Material{ GetTexture(Resources, "continue"), vec4f(1, 1, 1, 1) } }, RENDER_LAYER_UI));
 
 	exitGame->AddComponent(&SpriteRenderer("exit"
 		, Sprite{ vec3f(0, -120.0f), vec2f(200, 80)
-		, Material{ GetTexture(Resources, "exit"), vec4f(1, 1, 1, 1) } }));
+		, Material{ GetTexture(Resources, "exit"), vec4f(1, 1, 1, 1) } }, RENDER_LAYER_UI));
 
 	Scene->CurrentRoot->AddComponent(&SwitchState("switch1", "State 1"));
 	Scene->CurrentRoot->AddComponent(&SwitchState("switch2", "Quit Game"));
@@ -9,8 +9,8 @@ PauseScreen::PauseScreen(SceneManager *scene, Game_Resources *resources, char *p
 
 void PauseScreen::InitPauseGame()
 {
-	AddTexture(Resources, LoadTexture("resources\\textures\\resume.png"), "resume");
-	AddTexture(Resources, LoadTexture("resources\\textures\\return.png"), "return");
+	AddTexture(Resources, LoadAtlasTexture(&Resources->Atlas, "resources\\textures\\resume.png"), "resume");
+	AddTexture(Resources, LoadAtlasTexture(&Resources->Atlas, "resources\\textures\\return.png"), "return");
 
 	GameObject *currentRoot = Scene->CurrentRoot;
 
@@ -22,15 +22,15 @@ void PauseScreen::InitPauseGame()
 
 	background->AddComponent(&SpriteRenderer("bg"
 		, Sprite{ vec3f(80, -15), vec2f(1280, 720) 
-		, Material{ GetTexture(Resources, "back"), vec4f(0.5f, 0.5f, 0.5f, 1) } }));
+		, Material{ GetTexture(Resources, "back"), vec4f(0.5f, 0.5f, 0.5f, 1) } }, RENDER_LAYER_BACKGROUND));
 
 	resume->AddComponent(&SpriteRenderer("res"
 		, Sprite{ vec3f(), vec2f(200, 80) 
-		, Material{ GetTexture(Resources, "resume"), vec4f(1, 1, 0, 1) } }));
+		, Material{ GetTexture(Resources, "resume"), vec4f(1, 1, 0, 1) } }, RENDER_LAYER_UI));
 
 	returnToMenu->AddComponent(&SpriteRenderer("ret"
 		, Sprite{ vec3f(0, -120), vec2f(200, 80)
-		, Material{ GetTexture(Resources, "return"), vec4f(1, 1, 1, 1) } }));
+		, Material{ GetTexture(Resources, "return"), vec4f(1, 1, 1, 1) } }, RENDER_LAYER_UI));
 
 	Scene->CurrentRoot->AddComponent(&SwitchState("switch1", "State 1"));
 	Scene->CurrentRoot->AddComponent(&SwitchState("switch2", "State 2"));
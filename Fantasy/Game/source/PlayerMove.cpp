@@ -14,7 +14,14 @@ PlayerMove::PlayerMove(char *name, char * colliderName, float goalVelocity, bool
 void PlayerMove:: Init()
 {
 	currentvelocity = 0;
-	
+
+	//NOTE(kai): goalVelocity is in units per second, the physics engine does the moving
+	Collider *collider = (Collider *)Owner->GetComponent(colliderName, "COLLIDER");
+
+	if (collider)
+	{
+		collider->dynamic = true;
+	}
 
 }
 
@@ -25,7 +32,7 @@ void PlayerMove::Update(float delta, Game_Input *input)
 	currentvelocity = collider->velocity.X;
 
 	if ((!input->RIGHT.KeyDown) && (!input->LEFT.KeyDown)/*!input->LEFT.KeyDown&&!input->RIGHT.KeyDown*/){
-		collider->velocity.X = 0.0f;
+		collider->linearVelocity.X = 0.0f;
 		animator = (Animator *)Owner->GetComponent("animator", "ANIMATOR");
 		currentvelocity = 0.0f;
 		if ((!input->A.KeyDown) && (!input->S.KeyDown) && (!input->D.KeyDown) && (!input->W.KeyDown) && (!input->Space.KeyDown))
@@ -65,9 +72,8 @@ void PlayerMove::Update(float delta, Game_Input *input)
 				animator->SwitchClip("noe walk clip");
 			}
 
-			Owner->ObjectTransform.Position.X += currentvelocity;
 			Owner->ObjectTransform.Scale.X = 1;
-			collider->velocity.X = currentvelocity;
+			collider->linearVelocity.X = goalVelocity;
 		}
 	}
 	else if (input->LEFT.KeyDown)
@@ -91,11 +97,9 @@ void PlayerMove::Update(float delta, Game_Input *input)
 				animator->SwitchClip("noe walk clip");
 			}
 
-			Owner->ObjectTransform.Position.X += currentvelocity;
-
 			Owner->ObjectTransform.Scale.X = -1;
 
-			collider->velocity.X = currentvelocity;
+			collider->linearVelocity.X = -1.0f*goalVelocity;
 		}
 	}
 
@@ -11,7 +11,7 @@ PullBackMonster::PullBackMonster(char *name, Game_Resources *resources)
 
 void PullBackMonster::Init()
 {
-	AddTexture(Resources, LoadTexture("resources\\textures\\yellow.png"), "ArcMonster");
+	AddTexture(Resources, LoadAtlasTexture(&Resources->Atlas, "resources\\textures\\yellow.png"), "ArcMonster");
 
 }
 
@@ -40,6 +40,7 @@ void PullBackMonster::Update(float delta, Game_Input *input)
 		pullBackHide_flag = false;
 		PlayerCollide->playerHp -= 20;
 		pullBackMonster = this->Scene->AddObject("pullBackMonster");
+		pullBackMonster->Layer = "playerAttack";
 		pullBackMonster->ObjectTransform.Position = Owner->ObjectTransform.Position;
 		pullBackMonster->ObjectTransform.Position.X -= 200.0f*Owner->ObjectTransform.Scale.X;
 		pullBackMonster->AddComponent(&SpriteRenderer("PullBackMonster_sprite", Sprite{ vec3f(0, 0, 0), vec2f(300, 266), Material{ GetTexture(Resources, "hook"), vec4f(1, 1, 1, 1) } }));
@@ -11,7 +11,7 @@ StraightMonster::StraightMonster(char *name, Game_Resources *resources)
 
 void StraightMonster::Init()
 {
-	AddTexture(Resources, LoadTexture("resources\\textures\\Genta.png"), "Genta");
+	AddTexture(Resources, LoadAtlasTexture(&Resources->Atlas, "resources\\textures\\Genta.png"), "Genta");
 
 }
 
@@ -55,6 +55,7 @@ void StraightMonster::Update(float delta, Game_Input *input)
 				straight_hideFlag = false;
 				PlayerCollide->playerHp -= 20;
 				straightMonster = this->Scene->AddObject("straightMonster");
+				straightMonster->Layer = "playerAttack";
 				straightMonster->ObjectTransform.Position = Owner->ObjectTransform.Position;
 
 
@@ -64,6 +65,7 @@ void StraightMonster::Update(float delta, Game_Input *input)
 				straightMonster->ObjectTransform.Scale.X = Owner->ObjectTransform.Scale.X;
 				
 				straightMonster->AddComponent(&Collider("straightMon", &straightMonster->ObjectTransform.Position, vec2f(400, 266), vec2f(0, 0), 0, true));
+				((Collider *)straightMonster->GetComponent("straightMon", "COLLIDER"))->continuous = true;
 				straightMonster->AddComponent(&Animator("animator", (SpriteRenderer *)straightMonster->GetComponent("straightMonster_sprite", "RENDERABLE")));
 				//	Game_Scene.ActorManager.GetTransform("straight_Mon")->Position = vec3f(200.0f, -200.0f, 0);
 				Animator *animator = (Animator *)straightMonster->GetComponent("animator", "ANIMATOR");
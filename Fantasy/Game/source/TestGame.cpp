@@ -9,58 +9,58 @@
 void TestGame::Init()
 {
 	// textures 
-	/*AddTexture(&ResourceManager, LoadTexture("resources\\textures\\empty.png"), "Empty");
-	AddTexture(&ResourceManager, LoadTexture("resources\\textures\\back.png"), "back");*/
+	/*AddTexture(&ResourceManager, LoadAtlasTexture(&ResourceManager.Atlas, "resources\\textures\\empty.png"), "Empty");
+	AddTexture(&ResourceManager, LoadAtlasTexture(&ResourceManager.Atlas, "resources\\textures\\back.png"), "back");*/
 
-	AddTexture(&ResourceManager, LoadTexture("resources\\textures\\back.png"), "back");
-	AddTexture(&ResourceManager, LoadTexture("resources\\textures\\new grass1.png"), "grass forward");
-	AddTexture(&ResourceManager, LoadTexture("resources\\textures\\new grass22.png"), "grass back");
-	AddTexture(&ResourceManager, LoadTexture("resources\\textures\\double2.png"), "back trees");
-	AddTexture(&ResourceManager, LoadTexture("resources\\textures\\land piece2.png"), "floor");
-	AddTexture(&ResourceManager, LoadTexture("resources\\textures\\sky with clouds.png"), "sky");
-	AddTexture(&ResourceManager, LoadTexture("resources\\textures\\bar.png"), "black");
-	AddTexture(&ResourceManager, LoadTexture("resources\\textures\\left.png"), "left");
-	AddTexture(&ResourceManager, LoadTexture("resources\\textures\\middle.png"), "middle");
-	AddTexture(&ResourceManager, LoadTexture("resources\\textures\\right.png"), "right");
-	//AddTexture(&ResourceManager, LoadTexture("resources\\textures\\player_2.png"), "PLAYER");
-	AddTexture(&ResourceManager, LoadTexture("resources\\textures\\Neo In.png"), "neo");
+	AddTexture(&ResourceManager, LoadAtlasTexture(&ResourceManager.Atlas, "resources\\textures\\back.png"), "back");
+	AddTexture(&ResourceManager, LoadAtlasTexture(&ResourceManager.Atlas, "resources\\textures\\new grass1.png"), "grass forward");
+	AddTexture(&ResourceManager, LoadAtlasTexture(&ResourceManager.Atlas, "resources\\textures\\new grass22.png"), "grass back");
+	AddTexture(&ResourceManager, LoadAtlasTexture(&ResourceManager.Atlas, "resources\\textures\\double2.png"), "back trees");
+	AddTexture(&ResourceManager, LoadAtlasTexture(&ResourceManager.Atlas, "resources\\textures\\land piece2.png"), "floor");
+	AddTexture(&ResourceManager, LoadAtlasTexture(&ResourceManager.Atlas, "resources\\textures\\sky with clouds.png"), "sky");
+	AddTexture(&ResourceManager, LoadAtlasTexture(&ResourceManager.Atlas, "resources\\textures\\bar.png"), "black");
+	AddTexture(&ResourceManager, LoadAtlasTexture(&ResourceManager.Atlas, "resources\\textures\\left.png"), "left");
+	AddTexture(&ResourceManager, LoadAtlasTexture(&ResourceManager.Atlas, "resources\\textures\\middle.png"), "middle");
+	AddTexture(&ResourceManager, LoadAtlasTexture(&ResourceManager.Atlas, "resources\\textures\\right.png"), "right");
+	//AddTexture(&ResourceManager, LoadAtlasTexture(&ResourceManager.Atlas, "resources\\textures\\player_2.png"), "PLAYER");
+	AddTexture(&ResourceManager, LoadAtlasTexture(&ResourceManager.Atlas, "resources\\textures\\Neo In.png"), "neo");
 
-	AddTexture(&ResourceManager, LoadTexture("resources\\textures\\Noe X BasicAttack.png"), "noe basicattack");
-	AddTexture(&ResourceManager, LoadTexture("resources\\textures\\Noe X Idle.png"), "noe idle");
-	AddTexture(&ResourceManager, LoadTexture("resources\\textures\\Noe X Summon.png"), "noe summon");
-	AddTexture(&ResourceManager, LoadTexture("resources\\textures\\Noe X Walk.png"), "noe walk");
+	AddTexture(&ResourceManager, LoadAtlasTexture(&ResourceManager.Atlas, "resources\\textures\\Noe X BasicAttack.png"), "noe basicattack");
+	AddTexture(&ResourceManager, LoadAtlasTexture(&ResourceManager.Atlas, "resources\\textures\\Noe X Idle.png"), "noe idle");
+	AddTexture(&ResourceManager, LoadAtlasTexture(&ResourceManager.Atlas, "resources\\textures\\Noe X Summon.png"), "noe summon");
+	AddTexture(&ResourceManager, LoadAtlasTexture(&ResourceManager.Atlas, "resources\\textures\\Noe X Walk.png"), "noe walk");
 
 
 
-	AddTexture(&ResourceManager, LoadTexture("resources\\textures\\main Canvas.png"), "main Canvas");
+	AddTexture(&ResourceManager, LoadAtlasTexture(&ResourceManager.Atlas, "resources\\textures\\main Canvas.png"), "main Canvas");
 
 
-	AddTexture(&ResourceManager, LoadTexture("resources\\textures\\BG0.png"), "BG0");
-	AddTexture(&ResourceManager, LoadTexture("resources\\textures\\PlatForm2.png"), "PlatForm2");
+	AddTexture(&ResourceManager, LoadAtlasTexture(&ResourceManager.Atlas, "resources\\textures\\BG0.png"), "BG0");
+	AddTexture(&ResourceManager, LoadAtlasTexture(&ResourceManager.Atlas, "resources\\textures\\PlatForm2.png"), "PlatForm2");
 
 
-	AddTexture(&ResourceManager, LoadTexture("resources\\textures\\Asato Attack.png"), "straight_Mon");
-	AddTexture(&ResourceManager, LoadTexture("resources\\textures\\Weboo Attack.png"), "arc_Mon");
-	AddTexture(&ResourceManager, LoadTexture("resources\\textures\\Hook PushBack.png"), "hook");
-	AddTexture(&ResourceManager, LoadTexture("resources\\textures\\Jumpo Jump.png"), "jumpo");
+	AddTexture(&ResourceManager, LoadAtlasTexture(&ResourceManager.Atlas, "resources\\textures\\Asato Attack.png"), "straight_Mon");
+	AddTexture(&ResourceManager, LoadAtlasTexture(&ResourceManager.Atlas, "resources\\textures\\Weboo Attack.png"), "arc_Mon");
+	AddTexture(&ResourceManager, LoadAtlasTexture(&ResourceManager.Atlas, "resources\\textures\\Hook PushBack.png"), "hook");
+	AddTexture(&ResourceManager, LoadAtlasTexture(&ResourceManager.Atlas, "resources\\textures\\Jumpo Jump.png"), "jumpo");
 
 
-	AddTexture(&ResourceManager, LoadTexture("resources\\textures\\Warrior.png"), "Warrior");
-	AddTexture(&ResourceManager, LoadTexture("resources\\textures\\Warrior Idle.png"), "warrior idle");
-	AddTexture(&ResourceManager, LoadTexture("resources\\textures\\Warrior Walk.png"), "warrior walk");
-	AddTexture(&ResourceManager, LoadTexture("resources\\textures\\Warrior BasicAttack.png"), "wAttack");
+	AddTexture(&ResourceManager, LoadAtlasTexture(&ResourceManager.Atlas, "resources\\textures\\Warrior.png"), "Warrior");
+	AddTexture(&ResourceManager, LoadAtlasTexture(&ResourceManager.Atlas, "resources\\textures\\Warrior Idle.png"), "warrior idle");
+	AddTexture(&ResourceManager, LoadAtlasTexture(&ResourceManager.Atlas, "resources\\textures\\Warrior Walk.png"), "warrior walk");
+	AddTexture(&ResourceManager, LoadAtlasTexture(&ResourceManager.Atlas, "resources\\textures\\Warrior BasicAttack.png"), "wAttack");
 
 
-	AddTexture(&ResourceManager, LoadTexture("resources\\textures\\Wizard.png"), "Wizard");
-	AddTexture(&ResourceManager, LoadTexture("resources\\textures\\Wizard Idle.png"), "wizard idle");
-	AddTexture(&ResourceManager, LoadTexture("resources\\textures\\Wizzard Walk.png"), "wizard walk");
-	AddTexture(&ResourceManager, LoadTexture("resources\\textures\\Wizard Attack.png"), "wizard attack");
-	AddTexture(&ResourceManager, LoadTexture("resources\\textures\\Water Attack.png"), "wizard Projectile");
+	AddTexture(&ResourceManager, LoadAtlasTexture(&ResourceManager.Atlas, "resources\\textures\\Wizard.png"), "Wizard");
+	AddTexture(&ResourceManager, LoadAtlasTexture(&ResourceManager.Atlas, "resources\\textures\\Wizard Idle.png"), "wizard idle");
+	AddTexture(&ResourceManager, LoadAtlasTexture(&ResourceManager.Atlas, "resources\\textures\\Wizzard Walk.png"), "wizard walk");
+	AddTexture(&ResourceManager, LoadAtlasTexture(&ResourceManager.Atlas, "resources\\textures\\Wizard Attack.png"), "wizard attack");
+	AddTexture(&ResourceManager, LoadAtlasTexture(&ResourceManager.Atlas, "resources\\textures\\Water Attack.png"), "wizard Projectile");
 
-	AddTexture(&ResourceManager, LoadTexture("resources\\textures\\Rufus Idle.png"), "rufus idle");
-	AddTexture(&ResourceManager, LoadTexture("resources\\textures\\Rufus Walk.png"), "rufus walk");
-	AddTexture(&ResourceManager, LoadTexture("resources\\textures\\Rufus Attack1.png"), "rufus attack basic");
-	AddTexture(&ResourceManager, LoadTexture("resources\\textures\\Rufus Attack2.png"), "rufus attack advance");
+	AddTexture(&ResourceManager, LoadAtlasTexture(&ResourceManager.Atlas, "resources\\textures\\Rufus Idle.png"), "rufus idle");
+	AddTexture(&ResourceManager, LoadAtlasTexture(&ResourceManager.Atlas, "resources\\textures\\Rufus Walk.png"), "rufus walk");
+	AddTexture(&ResourceManager, LoadAtlasTexture(&ResourceManager.Atlas, "resources\\textures\\Rufus Attack1.png"), "rufus attack basic");
+	AddTexture(&ResourceManager, LoadAtlasTexture(&ResourceManager.Atlas, "resources\\textures\\Rufus Attack2.png"), "rufus attack advance");
 
 	AddBGM(&ResourceManager, "resources\\audio\\Game-Menu_Looping.wav", "menu");
 	AddBGM(&ResourceManager, "resources\\audio\\Forest-Chase_Looping.wav", "game");
@@ -76,6 +76,7 @@ void TestGame::Init()
    
 	Scene->REngine.InitShader("resources\\shaders\\vertex shader 120.vert", "resources\\shaders\\fragment shader 120.frag");
 	Scene->REngine.InitDebugShader("resources\\shaders\\vertex shader 120_2.vert", "resources\\shaders\\fragment shader 120_2.frag");
+	Scene->REngine.InitInstancedShader("resources\\shaders\\instanced vertex shader 120.vert", "resources\\shaders\\fragment shader 120.frag");
 
 	/*
 	*/
@@ -96,17 +97,20 @@ void TestGame::Init()
 	state1->AddComponent(&SwitchState("switch", "State 3"));
 	state1->AddComponent(&PauseGame((SwitchState *)state1->GetComponent("switch", "SWITCH")));
 
-	GameObject *tillingsky1 = Scene->AddObject("sky1");
-	GameObject *tillingsky2 = Scene->AddObject("sky2");
-	tillingsky1->AddComponent(&Tilling("tilling4", &this->ResourceManager, "sky1", "sky2", vec3f(0.0f, 400.0f, -20.0f), vec2f((Dimensions.Width * 2.5 + 400.0f), 2085), "sky", Dimensions.Width, 0.0f));
+	GameObject *sky = Scene->AddObject("sky");
+	sky->ObjectTransform.Position = vec3f(0.0f, 400.0f, -20.0f);
+	sky->AddComponent(&ParallaxLayer("sky layer"
+		, Sprite{ vec3f(0, 0, 0), vec2f((Dimensions.Width * 2.5 + 400.0f), 2085), Material{ GetTexture(&ResourceManager, "sky"), vec4f(1, 1, 1, 1) } }, 0.0f));
 
-	GameObject *tillingtrees1 = Scene->AddObject("trees1");
-	GameObject *tillingtrees2 = Scene->AddObject("trees2");
-	tillingtrees1->AddComponent(&Tilling("tilling3", &this->ResourceManager, "trees1", "trees2", vec3f(0.0f, 400.0f, -20.0f), vec2f((Dimensions.Width * 2.5 + 400.0f), 3085), "back trees", Dimensions.Width, 0.6f));
+	GameObject *trees = Scene->AddObject("trees");
+	trees->ObjectTransform.Position = vec3f(0.0f, 400.0f, -20.0f);
+	trees->AddComponent(&ParallaxLayer("trees layer"
+		, Sprite{ vec3f(0, 0, 0), vec2f((Dimensions.Width * 2.5 + 400.0f), 3085), Material{ GetTexture(&ResourceManager, "back trees"), vec4f(1, 1, 1, 1) } }, 0.6f, RENDER_LAYER_BACKGROUND + 1));
 
-	GameObject *tillingBack1 = Scene->AddObject("back1");
-	GameObject *tillingBack2 = Scene->AddObject("back2");
-	tillingBack1->AddComponent(&Tilling("tilling1", &this->ResourceManager, "back1", "back2", vec3f(0.0f, -350.0f, -1.0f), vec2f((Dimensions.Width * 2.5 + 400.0f), 300), "grass back", Dimensions.Width, 0.4f));
+	GameObject *back = Scene->AddObject("back");
+	back->ObjectTransform.Position = vec3f(0.0f, -350.0f, -1.0f);
+	back->AddComponent(&ParallaxLayer("grass back layer"
+		, Sprite{ vec3f(0, 0, 0), vec2f((Dimensions.Width * 2.5 + 400.0f), 300), Material{ GetTexture(&ResourceManager, "grass back"), vec4f(1, 1, 1, 1) } }, 0.4f, RENDER_LAYER_BACKGROUND + 2));
 
 	// collider (colliderName , pos * vec3 , size vec2 , offest vec2 , ground , trigger)
 
@@ -117,9 +121,10 @@ void TestGame::Init()
 		GameObject *tillingFloor2 = Scene->AddObject("floor2");
 		tillingFloor1->AddComponent(&Tilling("tilling8", &this->ResourceManager, "floor1", "floor2", vec3f(0.0f, -350.0f, -1.0f), vec2f((Dimensions.Width * 2.5 + 400.0f), 300), "grass back", Dimensions.Width, 0.4f));
 		*/
-		GameObject *tillingfloor1 = Scene->AddObject("floor1");
-		GameObject *tillingfloor2 = Scene->AddObject("floor2");
-		tillingfloor1->AddComponent(&Tilling("tillingf", &this->ResourceManager, "floor1", "floor2", vec3f(0.0f, -600.0f, -1.0f), vec2f((Dimensions.Width * 2.5 + 400.0f), 300), "floor", Dimensions.Width, 0.0f));
+		GameObject *floorLayer = Scene->AddObject("floor");
+		floorLayer->ObjectTransform.Position = vec3f(0.0f, -600.0f, -1.0f);
+		floorLayer->AddComponent(&ParallaxLayer("floor layer"
+			, Sprite{ vec3f(0, 0, 0), vec2f((Dimensions.Width * 2.5 + 400.0f), 300), Material{ GetTexture(&ResourceManager, "floor"), vec4f(1, 1, 1, 1) } }, 0.0f, RENDER_LAYER_BACKGROUND + 3));
 
 		/*GameObject *objp0 = Scene->AddObject("objp0");
 		objp0->AddComponent(&SpriteRenderer("r1", Sprite{ vec3f(0, 0, 0), vec2f(2035, 300), Material{ GetTexture(&ResourceManager, "floor"), vec4f(1, 1, 1, 1) } }));
@@ -135,9 +140,30 @@ void TestGame::Init()
 
 
 
+	}
+
+	// collision layers, pairs between layers that never interact don't reach the narrowphase
+	{
+		char *enemyAttacks[] = { "warrior", "wizard", "rufusBasicAttack", "rufusAdvanceAttack" };
+
+		for (uint32 i = 0; i < 4; i++)
+		{
+			for (uint32 j = i; j < 4; j++)
+			{
+				Scene->PEngine.SetLayerCollision(enemyAttacks[i], enemyAttacks[j], false);
+			}
+
+			Scene->PEngine.SetLayerCollision(enemyAttacks[i], "enemy", false);
+			Scene->PEngine.SetLayerCollision(enemyAttacks[i], "playerAttack", false);
+		}
+
+		Scene->PEngine.SetLayerCollision("enemy", "enemy", false);
+		Scene->PEngine.SetLayerCollision("playerAttack", "playerAttack", false);
+		Scene->PEngine.SetLayerCollision("playerAttack", "player", false);
 	}
 
 	GameObject *MainPlayer = Scene->AddObject("player");
+	MainPlayer->Layer = "player";
 	//GameObject *enemy_warrior1 = Scene->AddObject("warrior1");
 
 
@@ -150,6 +176,7 @@ void TestGame::Init()
 	MainPlayer->AddComponent(&Animator("animator", (SpriteRenderer *)MainPlayer->GetComponent("r1", "RENDERABLE")));
 
 	GameObject *enemyw1 = Scene->AddObject("enemyw1");
+	enemyw1->Layer = "enemy";
 	enemyw1->AddComponent(&SpriteRenderer("enemy1w_sprite", Sprite{ vec3f(0, 0, 0), vec2f(350, 466), Material{ GetTexture(&this->ResourceManager, "Warrior"), vec4f(1, 1, 1, 1) } }));
 	enemyw1->ObjectTransform.Position.X = 100.0f;
 	enemyw1->AddComponent(&Collider("enemyw1Collider", &enemyw1->ObjectTransform.Position, vec2f(300, 466), vec2f(0, 0), false, 1));
@@ -159,6 +186,7 @@ void TestGame::Init()
 	//enemyw1->Layer = "warrior";
 
 	GameObject *enemywizard1 = Scene->AddObject("enemywizard1");
+	enemywizard1->Layer = "enemy";
 	enemywizard1->AddComponent(&SpriteRenderer("enemy1wizard_sprite", Sprite{ vec3f(0, 0, 0), vec2f(350, 566), Material{ GetTexture(&this->ResourceManager, "Wizard"), vec4f(1, 1, 1, 1) } }));
 	enemywizard1->AddComponent(&Collider("enemywizard1Collider", &enemywizard1->ObjectTransform.Position, vec2f(300, 566), vec2f(0, 0), false, 1));
 	enemywizard1->AddComponent(&EnemyWizardMind("myMind", &ResourceManager, "enemywizard1", vec3f(300, 0, 0), "enemywizard1Attack", "enemywizard1HP", "wizard idle clip", "wizard walk clip", "wizard attack clip", "enemywizard1Collider", "enemy1wizard_sprite"));
@@ -166,6 +194,7 @@ void TestGame::Init()
 	//enemywizard1->Layer = "wizard";
 
 	GameObject *enemyRufus = Scene->AddObject("enemyRufus");
+	enemyRufus->Layer = "enemy";
 	enemyRufus->AddComponent(&SpriteRenderer("enemyrufus_sprite", Sprite{ vec3f(0, 0, 0), vec2f(300 * 3.0f, 266 * 4.0f), Material{ GetTexture(&this->ResourceManager, "Wizard"), vec4f(1, 1, 1, 1) } }));
 	enemyRufus->ObjectTransform.Position.X = 900.0f;
 	//enemyRufus->ObjectTransform.Position.Y = 900.0f;
@@ -201,26 +230,25 @@ void TestGame::Init()
 
 	//tiling area
 
-	GameObject *tillingforword1 = Scene->AddObject("forword1");
-	GameObject *tillingforword2 = Scene->AddObject("forword2");
-	tillingforword1->AddComponent(&Tilling("tilling2", &this->ResourceManager, "forword1", "forword2", vec3f(0.0f, -630.0f, 0.0f), vec2f((Dimensions.Width * 2.5 + 400.0f), 300), "grass forward", Dimensions.Width, -0.8f));
+	GameObject *forword = Scene->AddObject("forword");
+	forword->ObjectTransform.Position = vec3f(0.0f, -630.0f, 0.0f);
+	forword->AddComponent(&ParallaxLayer("grass forward layer"
+		, Sprite{ vec3f(0, 0, 0), vec2f((Dimensions.Width * 2.5 + 400.0f), 300), Material{ GetTexture(&ResourceManager, "grass forward"), vec4f(1, 1, 1, 1) } }, -0.8f, RENDER_LAYER_FOREGROUND));
 
 	//black area
 	{
 
-		GameObject *tillingblack1 = Scene->AddObject("black1");
-		GameObject *tillingblack2 = Scene->AddObject("black2");
-		tillingblack1->AddComponent(&Tilling("tillingb", &this->ResourceManager,
-			"black1", "black2", vec3f(0.0f, -800.0f, 0.0f), vec2f((Dimensions.Width * 2.5 + 400.0f), 100),
-			"black", Dimensions.Width, 0.0f));
+		GameObject *black1 = Scene->AddObject("black1");
+		black1->ObjectTransform.Position = vec3f(0.0f, -800.0f, 0.0f);
+		black1->AddComponent(&ParallaxLayer("bottom black layer"
+			, Sprite{ vec3f(0, 0, 0), vec2f((Dimensions.Width * 2.5 + 400.0f), 100), Material{ GetTexture(&ResourceManager, "black"), vec4f(1, 1, 1, 1) } }, 0.0f, RENDER_LAYER_FOREGROUND + 1));
 
 
 
-		GameObject *tillingblack11 = Scene->AddObject("black11");
-		GameObject *tillingblack22 = Scene->AddObject("black22");
-		tillingblack11->AddComponent(&Tilling("tillingbb", &this->ResourceManager,
-			"black11", "black22", vec3f(0.0f, 800.0f, 0.0f), vec2f((Dimensions.Width * 2.5 + 400.0f), 100),
-			"black", Dimensions.Width, 0.0f));
+		GameObject *black2 = Scene->AddObject("black2");
+		black2->ObjectTransform.Position = vec3f(0.0f, 800.0f, 0.0f);
+		black2->AddComponent(&ParallaxLayer("top black layer"
+			, Sprite{ vec3f(0, 0, 0), vec2f((Dimensions.Width * 2.5 + 400.0f), 100), Material{ GetTexture(&ResourceManager, "black"), vec4f(1, 1, 1, 1) } }, 0.0f, RENDER_LAYER_FOREGROUND + 1));
 
 
 	}
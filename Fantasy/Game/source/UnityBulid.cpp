@@ -5,7 +5,6 @@
 #include "PlayerMove.cpp"
 #include "Jump.cpp"
 #include "ApplyGravity.cpp"
-#include "Tilling.cpp"
 #include "BasicAttack.cpp"
 #include "StraightMonster.cpp"
 #include "PullBackMonster.cpp"
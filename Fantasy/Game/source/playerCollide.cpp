@@ -23,12 +23,12 @@ void playerCollide::Init()
 	mainCanvas->ObjectTransform.Position = Owner->ObjectTransform.Position;
 	mainCanvas->ObjectTransform.Position.Y += 600;
 	mainCanvas->ObjectTransform.Position.X -= 1000;
-	mainCanvas->AddComponent(&SpriteRenderer("mainCanvas", Sprite{ vec3f(0, 0, 0), vec2f(150 * 2.5f, 25 * 4.0f), Material{ GetTexture(Resources, "main Canvas"), vec4f(1, 1, 1, 1) } }));
+	mainCanvas->AddComponent(&SpriteRenderer("mainCanvas", Sprite{ vec3f(0, 0, 0), vec2f(150 * 2.5f, 25 * 4.0f), Material{ GetTexture(Resources, "main Canvas"), vec4f(1, 1, 1, 1) } }, RENDER_LAYER_WORLD + 1));
 
 	playerHpBar = this->Scene->AddObject("playerHpBar");
 	playerHpBar->ObjectTransform.Position = Owner->ObjectTransform.Position;
 	playerHpBar->ObjectTransform.Position.Y += 200;
-	playerHpBar->AddComponent(&SpriteRenderer("playerHpBar_sprite", Sprite{ vec3f(0, 0, 0), vec2f(150 , 25), Material{ GetTexture(Resources, "Empty"), vec4f(0, 1, .5, 1) } }));
+	playerHpBar->AddComponent(&SpriteRenderer("playerHpBar_sprite", Sprite{ vec3f(0, 0, 0), vec2f(150 , 25), Material{ GetTexture(Resources, "Empty"), vec4f(0, 1, .5, 1) } }, RENDER_LAYER_WORLD + 2));
 
 }
 
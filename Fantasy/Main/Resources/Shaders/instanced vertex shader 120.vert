@@ -0,0 +1,22 @@
+#version 120
+
+//NOTE(kai): corner comes from the shared unit quad, everything else is per sprite
+attribute vec2 corner;
+attribute vec4 axes;
+attribute vec4 origin;
+attribute vec4 uvRect;
+attribute vec4 color;
+
+varying vec2 outputTexCoords;
+varying vec4 myColor;
+
+uniform mat4 projectionMatrix;
+
+void main()
+{
+	vec2 position = origin.xy + axes.xy * corner.x + axes.zw * corner.y;
+
+	gl_Position = projectionMatrix * vec4(position, origin.z, 1.0);
+	outputTexCoords = uvRect.xy + (corner + 0.5) * uvRect.zw;
+	myColor = color;
+}
\ No newline at end of file
@@ -1,11 +1,10 @@
 #version 120
 
 //NOTE(kai): attribute takes values into the vertex shader (same as in)
-attribute vec3 position;	
+//NOTE(kai): laid out by the engine's sprite vertex format, uv and color arrive already normalized
+attribute vec2 position;	
 attribute vec2 inputTexCoords;	
 attribute vec4 color;
-attribute float slot;
-attribute vec3 normal;
 //NOTE(kai): varying takes values out of the vertex shader (same as out) and into the fragment shader (same as out)
 varying vec2 outputTexCoords;
 varying vec4 myColor;
@@ -16,7 +15,7 @@ uniform mat4 projectionMatrix;
 
 void main()
 {
-	gl_Position = projectionMatrix * modelMatrix * vec4(position, 1.0f);
+	gl_Position = projectionMatrix * modelMatrix * vec4(position, 0.0f, 1.0f);
 	outputTexCoords = inputTexCoords;
 	myColor = color;
 }
\ No newline at end of file
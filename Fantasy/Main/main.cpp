@@ -3,7 +3,7 @@
 
 int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE prevInstance, LPSTR cmdLine, int cmdShow)
 {
-	Win32_Core Core = Win32_Core();
+	Win32_Core Core;
 	Core.CreateConsole();	
 	Core.InitSystem(hInstance, new TestGame(), "Kai", 1280, 720, 60);
 	Core.Run();
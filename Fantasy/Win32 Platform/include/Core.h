@@ -3,7 +3,10 @@
 #include "InputManager.h"
 #include "WindowManager.h"
 #include <BasicGame.h>
+#include <RenderSnapshot.h>
 #include <stdint.h>
+#include <thread>
+#include <atomic>
 //
 
 struct Win32_Core
@@ -18,7 +21,8 @@ public:
 
 	static LRESULT CALLBACK WindowCallBack(HWND window, UINT message, WPARAM wParam, LPARAM lParam);
 
-	void InitSystem(HINSTANCE hInstance, BasicGame *game, char *title, int width, int height, int ups);
+	//NOTE(kai): with threadedRendering the updates stay on this thread and a render thread takes the window's context
+	void InitSystem(HINSTANCE hInstance, BasicGame *game, char *title, int width, int height, int ups, bool threadedRendering = true);
 
 	void CreateConsole();
 
@@ -31,6 +35,13 @@ private:
 
 	void MainLoop();
 
+	//NOTE(kai): false when no second context could be made, everything stays on this thread then
+	bool StartRenderThread();
+
+	void StopRenderThread();
+
+	void RenderLoop();
+
 	float GetSecondsElapsed(LARGE_INTEGER start, LARGE_INTEGER end);
 
 	void PrintTimeElapsed(LARGE_INTEGER start, LARGE_INTEGER end);
@@ -47,6 +58,18 @@ private:
 	float UPS;
 	WindowManager Window;
 	WINDOWPLACEMENT PrevWindowPlacement;
+
+	bool ThreadedRendering;
+	std::thread RenderThread;
+	RenderSnapshotBuffer Snapshots;
+
+	//NOTE(kai): the window's context belongs to the render thread, the update thread loads through the shared one
+	HGLRC RenderContext;
+	HGLRC UpdateContext;
+
+	std::atomic<bool> Rendering;
+	std::atomic<bool> ViewportChanged;
+
 	static bool IsRunning;
 	static Win32_Core *Core;
 };
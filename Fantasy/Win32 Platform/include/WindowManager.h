@@ -24,6 +24,9 @@ bool InitGlew(HINSTANCE hInstance);
 
 bool InitOpengl(HINSTANCE hIsntance, WindowManager *window);
 
+//Creates a context that shares textures, buffers and programs with the current one, so another thread can load while this one draws
+HGLRC CreateSharedContext(HWND window);
+
 void InitWindow(HINSTANCE hInstance, WindowManager *window, char* title, int width, int height, ClearColor color = ClearColor{ 0.0f, 0.3f, 0.4f, 1.0f });
 
 //Renders our window (this should happen each frame)
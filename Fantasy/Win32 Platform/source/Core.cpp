@@ -42,7 +42,7 @@ void Win32_Core::SwitchFullScreen(HWND hwnd)
 			GetClientRect(Window.Window, &windowRect);
 			Window.Width = windowRect.right;
 			Window.Height = windowRect.bottom;
-			SetViewPort(windowRect.left, windowRect.top, windowRect.right, windowRect.bottom);
+			ViewportChanged = true;
 		}
 	}
 	else 
@@ -60,7 +60,7 @@ void Win32_Core::SwitchFullScreen(HWND hwnd)
 		GetClientRect(Window.Window, &windowRect);
 		Window.Width = windowRect.right;
 		Window.Height = windowRect.bottom;
-		SetViewPort(windowRect.left, windowRect.top, windowRect.right, windowRect.bottom);
+		ViewportChanged = true;
 	}
 }
 
@@ -96,7 +96,7 @@ LRESULT CALLBACK Win32_Core::WindowCallBack(HWND window, UINT message, WPARAM wP
 	return result;
 }
 
-void Win32_Core::InitSystem(HINSTANCE hInstance, BasicGame *game, char *title, int width, int height, int ups)
+void Win32_Core::InitSystem(HINSTANCE hInstance, BasicGame *game, char *title, int width, int height, int ups, bool threadedRendering)
 {
 	PrevWindowPlacement = { sizeof(PrevWindowPlacement) };
 	Window = {};
@@ -110,6 +110,13 @@ void Win32_Core::InitSystem(HINSTANCE hInstance, BasicGame *game, char *title, i
 
 	Game = game;
 
+	//NOTE(kai): the game loads everything on this thread first, the render thread only starts with the main loop
+	ThreadedRendering = threadedRendering;
+	RenderContext = NULL;
+	UpdateContext = NULL;
+	Rendering = false;
+	ViewportChanged = false;
+
 	//Initialize SDL AUDIO
 	if (SDL_Init(SDL_INIT_AUDIO) < 0)
 	{
@@ -242,6 +249,89 @@ void Win32_Core::PrintTimeElapsed(LARGE_INTEGER start, LARGE_INTEGER end)
 	std::cout<< "ms/f: " << msPerFrame << ", FPS: " << fps << "\n";
 }
 
+bool Win32_Core::StartRenderThread()
+{
+	RenderContext = wglGetCurrentContext();
+	UpdateContext = CreateSharedContext(Window.Window);
+
+	if (!UpdateContext)
+	{
+		std::cout << "Couldn't create a shared opengl context, rendering on the update thread\n";
+		return false;
+	}
+
+	//NOTE(kai): a context is only ever current on one thread, this one moves over to the shared one
+	HDC windowDC = GetDC(Window.Window);
+	wglMakeCurrent(windowDC, UpdateContext);
+	ReleaseDC(Window.Window, windowDC);
+
+	ResetGLState();
+
+	InitSnapshotBuffer(&Snapshots);
+	Game->SetRenderThreaded(true);
+
+	Rendering = true;
+	RenderThread = std::thread(&Win32_Core::RenderLoop, this);
+
+	SetGLRenderThread(RenderThread.get_id());
+
+	return true;
+}
+
+void Win32_Core::StopRenderThread()
+{
+	Rendering = false;
+	CloseSnapshotBuffer(&Snapshots);
+
+	RenderThread.join();
+
+	//NOTE(kai): back to the window's context for shutting down, whatever the render thread didn't release yet goes now
+	HDC windowDC = GetDC(Window.Window);
+	wglMakeCurrent(windowDC, RenderContext);
+	ReleaseDC(Window.Window, windowDC);
+
+	wglDeleteContext(UpdateContext);
+	UpdateContext = NULL;
+
+	ResetGLState();
+	ClearGLRenderThread();
+
+	Game->SetRenderThreaded(false);
+}
+
+void Win32_Core::RenderLoop()
+{
+	HDC windowDC = GetDC(Window.Window);
+	wglMakeCurrent(windowDC, RenderContext);
+
+	while (Rendering)
+	{
+		//NOTE(kai): the timeout only matters when the update thread stops publishing, e.g. on the way out
+		RenderSnapshot *snapshot = AcquireSnapshot(&Snapshots, 100);
+
+		if (!snapshot)
+		{
+			continue;
+		}
+
+		if (ViewportChanged.exchange(false))
+		{
+			SetViewPort(0, 0, Window.Width, Window.Height);
+		}
+
+		ClearWindow();
+
+		Game->RenderFrame(snapshot);
+
+		RenderWindow(Window.Window);
+
+		PublishRenderStats(&Snapshots, &Game->Scene->REngine.Stats);
+	}
+
+	wglMakeCurrent(NULL, NULL);
+	ReleaseDC(Window.Window, windowDC);
+}
+
 //Our main loop which should continue running as long as we don't quite the game
 void Win32_Core::MainLoop()
 {
@@ -259,6 +349,8 @@ void Win32_Core::MainLoop()
 	ClearColor color = ClearColor{ 0, 0, 0, 1 };
 	SetClearColor(color);
 
+	bool threaded = ThreadedRendering && StartRenderThread();
+
 	LARGE_INTEGER lastTick = GetTicks();
 	float lag = 0;
 	float frameCounter = 0;
@@ -272,6 +364,8 @@ void Win32_Core::MainLoop()
 		lag += elapsed;		
 		frameCounter += elapsed;		
 
+		bool updated = false;
+
 		while (lag >= delta)
 		{
 			ProcessPendingMessages(&Keys);
@@ -279,18 +373,60 @@ void Win32_Core::MainLoop()
 			Game->Update(delta);
 			lag -= delta;
 			updates++;
+			updated = true;
 		}
 
-		ClearWindow();
+		if (threaded)
+		{
+			//NOTE(kai): the render thread draws while the next updates run here. Without an update
+			//			 there's nothing new to hand over
+			if (updated)
+			{
+				RenderSnapshot *snapshot = BeginSnapshot(&Snapshots);
+				Game->CaptureFrame(snapshot);
+				PublishSnapshot(&Snapshots);
+			}
+			else
+			{
+				Sleep(0);
+			}
+		}
+		else
+		{
+			if (ViewportChanged.exchange(false))
+			{
+				SetViewPort(0, 0, Window.Width, Window.Height);
+			}
+
+			ClearWindow();
 		
-		Game->Render();
+			Game->Render();
 
-		RenderWindow(Window.Window);
+			RenderWindow(Window.Window);
+
+			frames++;
+		}
 
-		frames++;
 		if (frameCounter > 1.0f)
 		{
-			std::cout << "FPS: " << frames << ", UPS: " << updates << std::endl;
+			RenderStats stats;
+
+			//NOTE(kai): the render thread keeps writing REngine.Stats, its frames and times come through the snapshot buffer
+			if (threaded)
+			{
+				frames += TakeRenderStats(&Snapshots, &stats);
+			}
+			else
+			{
+				stats = Game->Scene->REngine.Stats;
+			}
+
+			std::cout << "FPS: " << frames << ", UPS: " << updates
+				<< ", GPU ms: " << stats.GpuFrameTime
+				<< " (tile maps " << stats.GpuPassTimes[GPU_PASS_TILE_MAPS]
+				<< ", sprites " << stats.GpuPassTimes[GPU_PASS_SPRITES]
+				<< ", UI " << stats.GpuPassTimes[GPU_PASS_UI]
+				<< ", debug " << stats.GpuPassTimes[GPU_PASS_DEBUG] << ")" << std::endl;
 			frameCounter = 0;
 			frames = 0;
 			updates = 0;
@@ -302,6 +438,11 @@ void Win32_Core::MainLoop()
 		}
 	}
 
+	if (threaded)
+	{
+		StopRenderThread();
+	}
+
 	Release();
 }
 
@@ -202,4 +202,40 @@ bool InitOpengl(HINSTANCE hInstance, WindowManager *window)
 	ReleaseDC(window->Window, windowDC);
 
 	return true;
+}
+
+//NOTE(kai): made with the same settings as the window's context, NULL when the driver won't share with it
+HGLRC CreateSharedContext(HWND window)
+{
+	HGLRC current = wglGetCurrentContext();
+	HDC windowDC = GetDC(window);
+	HGLRC shared = NULL;
+
+	if (major > 2 && WGLEW_ARB_create_context)
+	{
+		int contextAttributes[] =
+		{
+			WGL_CONTEXT_MAJOR_VERSION_ARB, major,
+			WGL_CONTEXT_MINOR_VERSION_ARB, minor,
+			WGL_CONTEXT_FLAGS_ARB, 0,
+			WGL_CONTEXT_PROFILE_MASK_ARB, WGL_CONTEXT_COMPATIBILITY_PROFILE_BIT_ARB,
+			0 // End of attributes list
+		};
+
+		shared = wglCreateContextAttribsARB(windowDC, current, contextAttributes);
+	}
+	else
+	{
+		shared = wglCreateContext(windowDC);
+
+		if (shared && !wglShareLists(current, shared))
+		{
+			wglDeleteContext(shared);
+			shared = NULL;
+		}
+	}
+
+	ReleaseDC(window, windowDC);
+
+	return shared;
 }
\ No newline at end of file